@@ -0,0 +1,27 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <tacos/collective/collective.h>
+
+namespace tacos {
+
+/// @brief All-Reduce collective: every NPU ends up with the reduction of all chunks.
+/// @details Chunk c is reduced from the partial chunks of all NPUs (its postcondition) into
+/// precondition(c), as in ReduceScatter, and then gathered back to all NPUs, as in AllGather.
+/// The Synthesizer synthesizes the dual all-gather, and the gather of every chunk starts as
+/// soon as it is reduced, overlapping the reduction of the other chunks.
+class AllReduce final : public Collective {
+  public:
+    /// @brief Constructor for AllReduce collective
+    /// @param npusCount number of NPUs in the topology
+    /// @param collectivesCount number of chunks reduced into each NPU
+    explicit AllReduce(int npusCount, int collectivesCount = 1) noexcept;
+};
+}  // namespace tacos
@@ -0,0 +1,38 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <tacos/collective/collective.h>
+#include <vector>
+
+namespace tacos {
+
+/// @brief All-to-All collective: every NPU sends a distinct chunk to every other NPU.
+/// @details There are npusCount * (npusCount - 1) chunks per collective, one per (src, dest)
+/// pair, each of the chunk size the collective is synthesized with.
+class AllToAll final : public Collective {
+  public:
+    /// @brief Constructor for AllToAll collective
+    /// @param npusCount number of NPUs in the topology
+    /// @param collectivesCount number of chunks sent from each NPU to each other NPU
+    explicit AllToAll(int npusCount, int collectivesCount = 1) noexcept;
+};
+
+/// @brief All-to-All-v collective: every NPU sends a chunk of its own size to every other NPU.
+/// @details The chunk sent from src to dest has sizes[src][dest] bytes, and no chunk is sent
+/// if the size is 0 (or src == dest). The chunk size the collective is synthesized with is
+/// then only used for estimates (e.g., shortest-path times), so it is best set to the mean
+/// size of the chunks.
+class AllToAllv final : public Collective {
+  public:
+    /// @brief Constructor for AllToAllv collective
+    /// @param sizes sizes[src][dest]: size in bytes of the chunk sent from src to dest
+    explicit AllToAllv(const std::vector<std::vector<ChunkSize>>& sizes) noexcept;
+};
+}  // namespace tacos
@@ -0,0 +1,39 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <tacos/collective/collective.h>
+
+namespace tacos {
+
+/// @brief Broadcast collective: the buffer of a root NPU is copied to every NPU.
+/// @details The buffer is split into chunksCount chunks, all sourced at the root. The
+/// Synthesizer forwards every chunk as soon as it arrives, so that the chunks flow down
+/// different trees over the links of the root, pipelined one after the other.
+class Broadcast final : public Collective {
+  public:
+    /// @brief Constructor for Broadcast collective
+    /// @param npusCount number of NPUs in the topology
+    /// @param chunksCount number of chunks the buffer of the root is split into
+    /// @param root root NPU ID
+    explicit Broadcast(int npusCount, int chunksCount = 1, NpuID root = 0) noexcept;
+};
+
+/// @brief Reduce collective: a root NPU ends up with the reduction of the buffers of all NPUs.
+/// @details This is the time-reversed dual of Broadcast: each of the chunksCount chunks is
+/// owned by the root and reduced from the partial chunks of all NPUs (its postcondition).
+class Reduce final : public Collective {
+  public:
+    /// @brief Constructor for Reduce collective
+    /// @param npusCount number of NPUs in the topology
+    /// @param chunksCount number of chunks the buffers are split into
+    /// @param root root NPU ID
+    explicit Reduce(int npusCount, int chunksCount = 1, NpuID root = 0) noexcept;
+};
+}  // namespace tacos
@@ -8,9 +8,11 @@ Copyright (c) 2022-2025 Georgia Institute of Technology
 
 #pragma once
 
+#include <string>
+#include <tacos/event_queue/event_queue.h>
 #include <tacos/topology/topology.h>
-#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace tacos {
 
@@ -26,6 +28,8 @@ class Collective {
 
     using NpuID = Topology::NpuID;
 
+    using Time = EventQueue::Time;
+
     /// @brief Base class constructor for collective pattern
     Collective() noexcept;
 
@@ -34,6 +38,15 @@ class Collective {
     /// @return source NPU of the chunk
     [[nodiscard]] NpuID precondition(ChunkID chunk) const noexcept;
 
+    /// @brief Return the other NPUs initially holding a given chunk, besides its source
+    /// @param chunk chunk ID
+    /// @return NPUs holding a replica of the chunk (empty if the chunk is only at its source)
+    [[nodiscard]] const std::vector<NpuID>& replicas(ChunkID chunk) const noexcept;
+
+    /// @brief Check if some chunks are initially held by several NPUs
+    /// @return true if some chunks have replicas, false otherwise
+    [[nodiscard]] bool replicated() const noexcept;
+
     /// @brief Return the destination NPUs for a given chunk
     /// @param chunk chunk ID
     /// @return destination NPUs of the chunk
@@ -43,21 +56,129 @@ class Collective {
     /// @return number of chunks in the collective pattern
     [[nodiscard]] int chunksCount() const noexcept;
 
+    /// @brief Return the size of a given chunk
+    /// @param chunk chunk ID
+    /// @return size of the chunk in bytes,
+    /// or 0 if it is the chunk size the collective is synthesized with
+    [[nodiscard]] ChunkSize size(ChunkID chunk) const noexcept;
+
+    /// @brief Check if some chunks have a size of their own (e.g., AllToAllv)
+    /// @return true if some chunks have a size of their own, false otherwise
+    [[nodiscard]] bool sized() const noexcept;
+
+    /// @brief Return the release time of a given chunk
+    /// @param chunk chunk ID
+    /// @return time before which the chunk may not be sent (in microseconds)
+    [[nodiscard]] Time releaseTime(ChunkID chunk) const noexcept;
+
+    /// @brief Set the release time of a given chunk, e.g., once it is computed
+    /// @details A reduction collective releases the partial chunks of all NPUs at that time.
+    /// @param chunk chunk ID
+    /// @param time time before which the chunk may not be sent (in microseconds)
+    void releaseTime(ChunkID chunk, Time time) noexcept;
+
+    /// @brief Return the deadline of a given chunk
+    /// @param chunk chunk ID
+    /// @return time by which the chunk is needed at its destinations (in microseconds),
+    /// or infinity if it has none
+    [[nodiscard]] Time deadline(ChunkID chunk) const noexcept;
+
+    /// @brief Set the deadline of a given chunk, e.g., when the next layer needs it
+    /// @details Deadlines are a priority: the chunks with earlier deadlines claim links first,
+    /// yet may still arrive late. Reduction collectives ignore them.
+    /// @param chunk chunk ID
+    /// @param time time by which the chunk is needed at its destinations (in microseconds)
+    void deadline(ChunkID chunk, Time time) noexcept;
+
+    /// @brief Check if some chunks are released after time 0
+    /// @return true if some chunks have a release time, false otherwise
+    [[nodiscard]] bool staggered() const noexcept;
+
+    /// @brief Check if some chunks have deadlines
+    /// @return true if some chunks have a deadline, false otherwise
+    [[nodiscard]] bool prioritized() const noexcept;
+
+    /// @brief Get the name of the collective (e.g., the MSCCL "coll" attribute)
+    /// @return name of the collective
+    [[nodiscard]] const std::string& name() const noexcept;
+
+    /// @brief Check if the collective reduces its chunks
+    /// @details A reduction collective is described by its time-reversed dual: every chunk
+    /// is reduced from the NPUs of its postcondition into the NPU of its precondition.
+    /// It is synthesized as the dual collective, whose schedule is then reversed in time.
+    /// @return true if the collective reduces its chunks, false otherwise
+    [[nodiscard]] bool reduction() const noexcept;
+
+    /// @brief Check if the reduced chunks are then gathered back (e.g., AllReduce)
+    /// @details Every chunk of such a reduction collective, once reduced into the NPU of its
+    /// precondition, is sent back to all NPUs of its postcondition.
+    /// @return true if the reduced chunks are gathered back, false otherwise
+    [[nodiscard]] bool gathered() const noexcept;
+
   protected:
     /// @brief Number of chunks in the collective
     int chunksCount_ = 0;
 
+    /// @brief Name of the collective
+    std::string name_ = "custom";
+
+    /// @brief true if the collective reduces its chunks (see reduction())
+    bool reduction_ = false;
+
+    /// @brief true if the reduced chunks are gathered back (see gathered())
+    bool gathered_ = false;
+
     /// @brief Insert new precondition and postcondition for a chunk
-    void chunk_(NpuID src, std::unordered_set<NpuID> dests) noexcept;
+    /// @param src source NPU of the chunk
+    /// @param dests destination NPUs of the chunk
+    /// @param size size of the chunk in bytes (0: the chunk size of the synthesis)
+    void chunk_(NpuID src, std::unordered_set<NpuID> dests, ChunkSize size = 0) noexcept;
+
+    /// @brief Register a set of destination NPUs to be shared by several chunks
+    /// @param dests destination NPUs
+    /// @return index of the set, to insert chunks with via sharedChunk_()
+    [[nodiscard]] int destinations_(std::unordered_set<NpuID> dests) noexcept;
+
+    /// @brief Insert a new chunk with a registered set of destination NPUs
+    /// @param src source NPU of the chunk
+    /// @param destinations index of the destination NPUs, returned by destinations_()
+    /// @param size size of the chunk in bytes (0: the chunk size of the synthesis)
+    void sharedChunk_(NpuID src, int destinations, ChunkSize size = 0) noexcept;
+
+    /// @brief Mark a chunk as initially held by another NPU besides its source
+    /// @details Not supported by reduction collectives.
+    /// @param chunk chunk ID
+    /// @param npu NPU holding a replica of the chunk
+    void replicate_(ChunkID chunk, NpuID npu) noexcept;
+
+    /// @brief Reserve memory for a number of chunks
+    /// @param chunksCount number of chunks expected in the collective
+    void reserveChunks_(int chunksCount) noexcept;
 
   private:
     /// @brief New Chunk ID to be used
     int newChunkID_ = 0;
 
-    /// @brief Precondition: maps each chunk to the (single) source NPU
-    std::unordered_map<ChunkID, NpuID> precondition_ = {};
+    /// @brief Precondition: the (single) source NPU of each chunk
+    std::vector<NpuID> precondition_ = {};
+
+    /// @brief Postcondition: index of the destination NPUs of each chunk in destinationSets_
+    std::vector<int> postcondition_ = {};
+
+    /// @brief Sets of destination NPUs, shared by chunks
+    /// (e.g., all chunks of an AllGather share a single set)
+    std::vector<std::unordered_set<NpuID>> destinationSets_ = {};
+
+    /// @brief Replicas of the chunks besides their sources (empty if no chunk has replicas)
+    std::vector<std::vector<NpuID>> replicas_ = {};
+
+    /// @brief Release times of the chunks (empty if no chunk has one, and 0 past its end)
+    std::vector<Time> releaseTimes_ = {};
+
+    /// @brief Deadlines of the chunks (empty if no chunk has one, and infinity past its end)
+    std::vector<Time> deadlines_ = {};
 
-    /// @brief Postcondition: maps each chunk to (multiple) destination NPUs
-    std::unordered_map<ChunkID, std::unordered_set<NpuID>> postcondition_ = {};
+    /// @brief Sizes of the chunks in bytes (empty if no chunk has a size of its own)
+    std::vector<ChunkSize> sizes_ = {};
 };
 }  // namespace tacos
@@ -0,0 +1,36 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <tacos/collective/collective.h>
+
+namespace tacos {
+
+/// @brief Construct collectives from compact textual specifications.
+/// @details A specification has the form <kind>[:<collectivesCount>],
+/// e.g., "allgather" or "allgather:3" (3 initial chunks per NPU).
+/// Supported kinds are "allgather", "reducescatter", "allreduce", "alltoall", "broadcast", and
+/// "reduce" (the latter two from root NPU 0, with the buffer split into collectivesCount chunks).
+class CollectiveParser {
+  public:
+    /// @brief Parse a collective specification and construct the collective.
+    /// @param spec collective specification
+    /// @param npusCount number of NPUs in the target topology
+    /// @param maxCollectivesCount maximum collectivesCount of the specification
+    /// @return constructed collective, or nullptr if the specification is invalid
+    /// or exceeds maxCollectivesCount
+    [[nodiscard]] static std::unique_ptr<Collective> parse(
+        const std::string& spec,
+        int npusCount,
+        int maxCollectivesCount = std::numeric_limits<int>::max()) noexcept;
+};
+}  // namespace tacos
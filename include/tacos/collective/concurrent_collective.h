@@ -0,0 +1,65 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <tacos/collective/collective.h>
+#include <vector>
+
+namespace tacos {
+
+/// @brief Collectives running concurrently, each over its own group of NPUs (sub-communicator).
+/// @details Each added collective is mapped onto the NPUs of its group, and its chunks are
+/// appended to this collective, so that synthesizing this collective schedules all groups
+/// jointly, competing for the same links. The chunks of group g are the chunkIDs in
+/// [firstChunk(g), firstChunk(g) + member(g).chunksCount()), in the same order as in the
+/// added collective. Either all groups reduce their chunks (with the same Collective::gathered)
+/// or none does.
+class ConcurrentCollective final : public Collective {
+  public:
+    /// @brief Construct an empty set of concurrent collectives
+    ConcurrentCollective() noexcept;
+
+    /// @brief Add a collective running over a group of NPUs
+    /// @param collective collective over npus.size() NPUs
+    /// @param npus NPU of the topology standing for each NPU of the collective
+    /// @return group ID
+    int add(const Collective& collective, const std::vector<NpuID>& npus) noexcept;
+
+    /// @brief Get the number of groups
+    /// @return number of groups
+    [[nodiscard]] int groupsCount() const noexcept;
+
+    /// @brief Get the group of a chunk
+    /// @param chunk chunk ID
+    /// @return group ID of the chunk
+    [[nodiscard]] int group(ChunkID chunk) const noexcept;
+
+    /// @brief Get the first chunk of a group
+    /// @param group group ID
+    /// @return chunk ID of the first chunk of the group
+    [[nodiscard]] ChunkID firstChunk(int group) const noexcept;
+
+    /// @brief Get the collective of a group, over the NPUs of the topology
+    /// @param group group ID
+    /// @return collective of the group, whose chunk c is chunk firstChunk(group) + c
+    [[nodiscard]] const Collective& member(int group) const noexcept;
+
+  private:
+    /// @brief collective of each group, over the NPUs of the topology
+    std::vector<std::unique_ptr<Collective>> members_ = {};
+
+    /// @brief first chunk of each group
+    std::vector<ChunkID> firstChunks_ = {};
+
+    /// @brief group of each chunk
+    std::vector<int> groups_ = {};
+};
+
+}  // namespace tacos
@@ -0,0 +1,65 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <string>
+#include <tacos/collective/collective.h>
+#include <tacos/topology/topology.h>
+
+namespace tacos {
+
+/// @brief Collective with arbitrary preconditions and postconditions, loaded from a file.
+/// @details Chunks are defined in order, either in text or in binary (told by the magic).
+/// The text format has one chunk per line, "<src>[,<replicas>] <dests> [<size>]", where dests
+/// is "*" (all NPUs) or comma-separated NPU IDs and ranges (e.g., "0-3,8"), replicas are
+/// NPUs initially holding the chunk besides src (e.g., "0,4-5" if NPUs 4 and 5 hold replicas
+/// of the chunk of NPU 0), and size is in bytes (0 or omitted: the chunk size of the
+/// synthesis). Empty lines and lines starting with '#' are ignored, and a "name <name>" line
+/// names the collective.
+/// The binary format starts with the magic "TACOSCOL", followed by uint32 version (1),
+/// uint32 npusCount, uint64 chunksCount and uint32 flags (bit 0: chunks have sizes, bit 1:
+/// chunks have replicas), and then, for every chunk, int32 src, int64 size (if flagged), a
+/// bitmap of (npusCount + 7) / 8 bytes whose bit n (LSB first) marks NPU n as a destination,
+/// and a bitmap of the NPUs holding replicas (if flagged).
+/// Integers are little-endian. Chunks with the same destinations share a single set of them.
+class CustomCollective final : public Collective {
+  public:
+    /// @brief Load a collective from a file
+    /// @param path path of the text or binary file
+    /// @param topology topology the chunk definitions are validated against
+    /// @return loaded collective, or nullptr if the file is unreadable or invalid
+    [[nodiscard]] static std::unique_ptr<CustomCollective> load(const std::string& path,
+                                                                const Topology& topology) noexcept;
+
+    /// @brief Read a collective from a stream
+    /// @param input stream of the text or binary chunk definitions
+    /// @param topology topology the chunk definitions are validated against
+    /// @return read collective, or nullptr if the definitions are invalid
+    [[nodiscard]] static std::unique_ptr<CustomCollective> read(std::istream& input,
+                                                                const Topology& topology) noexcept;
+
+  private:
+    /// @brief Construct an empty collective
+    CustomCollective() noexcept;
+
+    /// @brief Read the text chunk definitions
+    /// @param input stream of the text chunk definitions
+    /// @param npusCount number of NPUs in the topology
+    /// @return true if the definitions are valid, false otherwise
+    [[nodiscard]] bool readText_(std::istream& input, int npusCount) noexcept;
+
+    /// @brief Read the binary chunk definitions (after the magic)
+    /// @param input stream of the binary chunk definitions
+    /// @param npusCount number of NPUs in the topology
+    /// @return true if the definitions are valid, false otherwise
+    [[nodiscard]] bool readBinary_(std::istream& input, int npusCount) noexcept;
+};
+}  // namespace tacos
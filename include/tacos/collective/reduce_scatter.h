@@ -0,0 +1,26 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <tacos/collective/collective.h>
+
+namespace tacos {
+
+/// @brief Reduce-Scatter collective: every NPU ends up with the reduction of its own chunks.
+/// @details This is the time-reversed dual of AllGather: chunk c is owned by precondition(c)
+/// and reduced from the partial chunks of all NPUs (its postcondition). The Synthesizer
+/// synthesizes the dual all-gather and reverses its schedule in time.
+class ReduceScatter final : public Collective {
+  public:
+    /// @brief Constructor for ReduceScatter collective
+    /// @param npusCount number of NPUs in the topology
+    /// @param collectivesCount number of reduced chunks owned by each NPU
+    explicit ReduceScatter(int npusCount, int collectivesCount = 1) noexcept;
+};
+}  // namespace tacos
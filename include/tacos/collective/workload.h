@@ -0,0 +1,84 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <tacos/collective/collective.h>
+#include <tacos/event_queue/event_queue.h>
+#include <vector>
+
+namespace tacos {
+
+/// @brief Collectives of a training iteration, along with the computations between them.
+/// @details The workload is a DAG of steps: every step issues a collective once all steps it
+/// depends on are complete and its own compute time has elapsed (e.g., per-layer
+/// ReduceScatter -> compute -> AllGather). A step only depends on earlier steps, so that the
+/// order of the steps is a topological order of the DAG. The release times and deadlines of
+/// the chunks of a step (see Collective::releaseTime) are relative to its issue time.
+class Workload {
+  public:
+    using Time = EventQueue::Time;
+    using ChunkSize = Collective::ChunkSize;
+    using StepID = int;
+
+    /// @brief Construct an empty workload
+    Workload() noexcept;
+
+    /// @brief Add a step issuing a collective
+    /// @param collective collective of the step (shared, as is, e.g., a ConcurrentCollective)
+    /// @param chunkSize size of each chunk of the collective (in bytes)
+    /// @param dependencies steps to complete before this step (all added earlier)
+    /// @param computeTime time between the completion of the dependencies and the issue of
+    /// the collective (in microseconds)
+    /// @return step ID
+    StepID add(std::shared_ptr<const Collective> collective,
+               ChunkSize chunkSize,
+               const std::vector<StepID>& dependencies = {},
+               Time computeTime = 0) noexcept;
+
+    /// @brief Get the number of steps
+    /// @return number of steps
+    [[nodiscard]] int stepsCount() const noexcept;
+
+    /// @brief Get the collective of a step
+    /// @param step step ID
+    /// @return collective of the step
+    [[nodiscard]] const Collective& collective(StepID step) const noexcept;
+
+    /// @brief Get the chunk size of a step
+    /// @param step step ID
+    /// @return size of each chunk of the collective (in bytes)
+    [[nodiscard]] ChunkSize chunkSize(StepID step) const noexcept;
+
+    /// @brief Get the dependencies of a step
+    /// @param step step ID
+    /// @return steps to complete before the step
+    [[nodiscard]] const std::vector<StepID>& dependencies(StepID step) const noexcept;
+
+    /// @brief Get the compute time of a step
+    /// @param step step ID
+    /// @return time between the completion of the dependencies and the issue of the collective
+    /// (in microseconds)
+    [[nodiscard]] Time computeTime(StepID step) const noexcept;
+
+  private:
+    /// @brief collective of each step
+    std::vector<std::shared_ptr<const Collective>> collectives_ = {};
+
+    /// @brief chunk size of each step
+    std::vector<ChunkSize> chunkSizes_ = {};
+
+    /// @brief dependencies of each step
+    std::vector<std::vector<StepID>> dependencies_ = {};
+
+    /// @brief compute time of each step
+    std::vector<Time> computeTimes_ = {};
+};
+
+}  // namespace tacos
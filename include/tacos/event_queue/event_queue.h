@@ -32,6 +32,10 @@ class EventQueue {
     /// @return next event time
     Time pop() noexcept;
 
+    /// @brief Get the next event time without popping it.
+    /// @return next event time
+    [[nodiscard]] Time peek() const noexcept;
+
     /// @brief Check the event queue is empty.
     /// @return true if no events are scheduled, false otherwise.
     [[nodiscard]] bool empty() noexcept;
@@ -49,4 +53,10 @@ class EventQueue {
     /// @brief Priority queue to manage event times in ascending order.
     std::priority_queue<Time, std::vector<Time>, std::greater<>> event_queue_ = {};
 };
+
+/// @brief Compare two event times for equality
+/// @param lhs event time
+/// @param rhs event time
+/// @return true if lhs and rhs are equal (epsilon 1e-9), false otherwise
+[[nodiscard]] bool isEqual(EventQueue::Time lhs, EventQueue::Time rhs) noexcept;
 }  // namespace tacos
@@ -0,0 +1,132 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <future>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tacos/collective/collective.h>
+#include <tacos/event_queue/event_queue.h>
+#include <tacos/service/thread_pool.h>
+#include <unordered_map>
+#include <utility>
+
+namespace tacos {
+
+/// @brief Caching synthesis service shared by many clients.
+/// @details Identical requests are synthesized only once:
+/// a request whose result is cached, or is currently being synthesized,
+/// shares the same result instead of running a new synthesis.
+/// New requests are synthesized on a shared thread pool.
+/// The cache holds a bounded number of results, evicting the least recently used first.
+class SynthesisService {
+  public:
+    // data types
+    using Time = EventQueue::Time;
+    using ChunkSize = Collective::ChunkSize;
+
+    /// @brief Maximum number of NPUs of a requested topology.
+    static constexpr int maxNpusCount = 256;
+
+    /// @brief Maximum number of chunks per NPU of a requested collective.
+    static constexpr int maxCollectivesCount = 16;
+
+    /// @brief Maximum synthesis time budget of a request (in milliseconds).
+    static constexpr double maxBudget = 60 * 1000;
+
+    /// @brief Synthesis request.
+    struct Request {
+        /// @brief Topology specification (see TopologyParser)
+        std::string topology;
+
+        /// @brief Collective specification (see CollectiveParser)
+        std::string collective;
+
+        /// @brief Size of each chunk (in bytes)
+        ChunkSize chunkSize;
+
+        /// @brief Synthesis time budget (in milliseconds)
+        /// @details The synthesis is repeated with random restarts until the budget is spent,
+        /// and the best result is kept. At least one synthesis is always run.
+        double budget;
+
+        /// @brief Key identifying identical requests.
+        /// @return request key
+        [[nodiscard]] std::string key() const noexcept;
+    };
+
+    /// @brief Synthesis response.
+    struct Response {
+        /// @brief true if the synthesis succeeded
+        bool ok;
+
+        /// @brief Best synthesized collective time (in microseconds)
+        Time collectiveTime;
+
+        /// @brief Number of syntheses run within the budget
+        int trials;
+
+        /// @brief Error message if the synthesis failed
+        std::string error;
+    };
+
+    /// @brief Construct the synthesis service.
+    /// @param threadsCount number of threads synthesizing requests
+    /// @param cacheCapacity maximum number of cached (or in-flight) results
+    explicit SynthesisService(int threadsCount, int cacheCapacity = 1024) noexcept;
+
+    /// @brief Submit a synthesis request.
+    /// @param request synthesis request
+    /// @param cached set to true if an identical request was already submitted (optional)
+    /// @return shared future holding the response
+    [[nodiscard]] std::shared_future<Response> submit(const Request& request,
+                                                      bool* cached = nullptr) noexcept;
+
+    /// @brief Handle a textual request line and produce a textual response line.
+    /// @details Request: "<topology> <collective> <chunkSize> <budget>", e.g.,
+    /// "mesh2d:4x3:50/0.5 allgather:3 349525 100".
+    /// Response: "ok <collectiveTime> <trials> <hit|miss>" or "error <message>".
+    /// Requests with fewer than 2 or more than maxNpusCount NPUs, more than maxCollectivesCount
+    /// chunks per NPU, nothing to transfer, or a budget above maxBudget are rejected.
+    /// @param line request line
+    /// @return response line (without a trailing newline)
+    [[nodiscard]] std::string handle(const std::string& line) noexcept;
+
+    /// @brief Parse a textual request line.
+    /// @param line request line
+    /// @return parsed request, or std::nullopt if the line is malformed
+    [[nodiscard]] static std::optional<Request> parseRequest(const std::string& line) noexcept;
+
+  private:
+    /// @brief Mutex guarding results_ and recency_.
+    std::mutex mutex_ = {};
+
+    /// @brief Request keys of the cached results, the most recently used first.
+    std::list<std::string> recency_ = {};
+
+    /// @brief Cached (or in-flight) responses, by request key, with their key in recency_.
+    std::unordered_map<std::string,
+                       std::pair<std::shared_future<Response>, std::list<std::string>::iterator>>
+        results_ = {};
+
+    /// @brief Maximum number of cached results.
+    int cacheCapacity_;
+
+    /// @brief Thread pool running the syntheses.
+    /// @details Declared last, so that workers are joined before other members are destroyed.
+    ThreadPool threadPool_;
+
+    /// @brief Run the synthesis of a request.
+    /// @param request synthesis request
+    /// @return synthesis response
+    [[nodiscard]] static Response synthesize_(const Request& request) noexcept;
+};
+}  // namespace tacos
@@ -0,0 +1,63 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace tacos {
+
+/// @brief Fixed-size pool of worker threads executing submitted tasks in FIFO order.
+class ThreadPool {
+  public:
+    /// @brief Task to be executed by a worker thread.
+    using Task = std::function<void()>;
+
+    /// @brief Construct a thread pool and start its worker threads.
+    /// @param threadsCount number of worker threads
+    explicit ThreadPool(int threadsCount) noexcept;
+
+    /// @brief Finish all submitted tasks and join the worker threads.
+    ~ThreadPool() noexcept;
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// @brief Submit a task to be executed by a worker thread.
+    /// @param task task to execute
+    void submit(Task task) noexcept;
+
+    /// @brief Get the number of worker threads.
+    /// @return number of worker threads
+    [[nodiscard]] int threadsCount() const noexcept;
+
+  private:
+    /// @brief Worker threads.
+    std::vector<std::thread> workers_ = {};
+
+    /// @brief Tasks waiting for a worker thread.
+    std::queue<Task> tasks_ = {};
+
+    /// @brief Mutex guarding tasks_ and stopping_.
+    std::mutex mutex_ = {};
+
+    /// @brief Condition variable to wake up idle workers.
+    std::condition_variable condition_ = {};
+
+    /// @brief true if the pool is shutting down.
+    bool stopping_ = false;
+
+    /// @brief Worker loop: pop and execute tasks until the pool stops.
+    void work_() noexcept;
+};
+}  // namespace tacos
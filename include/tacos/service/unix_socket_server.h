@@ -0,0 +1,100 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace tacos {
+
+/// @brief Line-based request/response server over a Unix domain socket.
+/// @details Each connection is served by its own thread: every newline-terminated
+/// request line is passed to the handler, and the returned response is written
+/// back followed by a newline. Connections may send any number of requests, each of at most
+/// maxRequestLength bytes. The connection threads are joined once the server stops.
+class UnixSocketServer {
+  public:
+    /// @brief Handler mapping a request line to a response line.
+    using Handler = std::function<std::string(const std::string&)>;
+
+    /// @brief Maximum length of a request line (in bytes), beyond which the connection is closed.
+    static constexpr std::size_t maxRequestLength = 1 << 16;
+
+    /// @brief Construct a Unix domain socket server.
+    /// @param path filesystem path of the socket
+    /// @param handler request handler (must be thread-safe and outlive the connections)
+    UnixSocketServer(std::string path, Handler handler) noexcept;
+
+    /// @brief Close the listening socket and remove the socket file.
+    ~UnixSocketServer() noexcept;
+
+    UnixSocketServer(const UnixSocketServer&) = delete;
+    UnixSocketServer& operator=(const UnixSocketServer&) = delete;
+
+    /// @brief Bind the socket and serve connections until stop() is called.
+    /// @details Once stopped, the open connections are shut down and their threads joined,
+    /// and the socket is closed and its file removed.
+    /// @return true if the server stopped normally, false if the socket failed
+    bool serve() noexcept;
+
+    /// @brief Stop accepting new connections.
+    /// @details Async-signal-safe, e.g., to stop the server on SIGTERM.
+    void stop() noexcept;
+
+  private:
+    /// @brief Filesystem path of the socket.
+    std::string path_;
+
+    /// @brief Request handler.
+    Handler handler_;
+
+    /// @brief Listening socket file descriptor (negative if not listening).
+    std::atomic<int> socket_ = -1;
+
+    /// @brief true if stop() has been called.
+    std::atomic<bool> stopping_ = false;
+
+    /// @brief Connection served by its own thread.
+    struct Connection {
+        /// @brief connection file descriptor (closed once the thread is joined)
+        int socket = -1;
+
+        /// @brief thread serving the connection
+        std::thread thread = {};
+
+        /// @brief true once the thread is done serving the connection
+        std::atomic<bool> done = false;
+    };
+
+    /// @brief Mutex guarding connections_.
+    std::mutex mutex_ = {};
+
+    /// @brief Connections not joined yet.
+    std::list<Connection> connections_ = {};
+
+    /// @brief Join the threads of the finished connections, or of all connections.
+    /// @param all true to shut down and join all connections, false for the finished ones only
+    void joinConnections_(bool all) noexcept;
+
+    /// @brief Serve requests of a single connection until the peer disconnects.
+    /// @param connection connection file descriptor
+    void handleConnection_(int connection) const noexcept;
+
+    /// @brief Write a whole response to a connection.
+    /// @param connection connection file descriptor
+    /// @param response response to write
+    /// @return true if the response was written, false if the peer disconnected
+    static bool write_(int connection, const std::string& response) noexcept;
+};
+}  // namespace tacos
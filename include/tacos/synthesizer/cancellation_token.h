@@ -0,0 +1,35 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+namespace tacos {
+
+/// @brief Cooperative cancellation flag shared between a caller and a running synthesis.
+/// @details Copies of a token share the same underlying flag,
+/// so a copy handed to the synthesizer observes cancel() calls on the original.
+class CancellationToken {
+  public:
+    /// @brief Construct a new (not cancelled) cancellation token.
+    CancellationToken() noexcept;
+
+    /// @brief Request cancellation of every synthesis observing this token.
+    void cancel() noexcept;
+
+    /// @brief Check whether cancellation has been requested.
+    /// @return true if cancel() has been called, false otherwise
+    [[nodiscard]] bool cancelled() const noexcept;
+
+  private:
+    /// @brief Shared cancellation flag.
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+}  // namespace tacos
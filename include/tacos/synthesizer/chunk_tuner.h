@@ -0,0 +1,88 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <tacos/collective/collective.h>
+#include <tacos/event_queue/event_queue.h>
+#include <tacos/topology/topology.h>
+
+namespace tacos {
+
+/// @brief Auto-tuner of the chunk granularity (i.e., collectivesCount) of a collective.
+/// @details Too few chunks underutilize the links, while too many chunks blow up
+/// the synthesis time. For a given buffer size, the tuner synthesizes the candidate
+/// chunk counts in increasing order of an analytic lower bound on their collective time,
+/// skips every candidate whose bound cannot beat the best collective time found so far,
+/// and stops when the synthesis-time budget is spent.
+class ChunkTuner {
+  public:
+    using Time = EventQueue::Time;
+    using ChunkSize = Collective::ChunkSize;
+
+    /// @brief Construct the collective to tune for a given number of initial chunks per NPU
+    using CollectiveFactory = std::function<std::unique_ptr<Collective>(int collectivesCount)>;
+
+    /// @brief Outcome of a tuning
+    struct Result {
+        /// @brief best number of initial chunks per NPU
+        int collectivesCount;
+
+        /// @brief synthesized collective time with the best chunk count (in microseconds)
+        Time collectiveTime;
+
+        /// @brief number of chunk counts synthesized
+        int synthesizedCount;
+
+        /// @brief number of chunk counts skipped thanks to the lower bound
+        int prunedCount;
+
+        /// @brief number of chunk counts left unsynthesized when the budget ran out
+        int unfinishedCount;
+    };
+
+    /// @brief Construct a chunk tuner
+    /// @param maxCollectivesCount largest number of initial chunks per NPU to consider
+    /// @param budget synthesis-time budget (in milliseconds)
+    ChunkTuner(int maxCollectivesCount, double budget) noexcept;
+
+    /// @brief Search the chunk count with the best collective time
+    /// @param topology target network topology
+    /// @param collectiveFactory constructs the target collective for a chunk count
+    /// @param bufferSize buffer size to split into chunks (in bytes)
+    /// @return best chunk count, or std::nullopt if no synthesis finished within the budget
+    [[nodiscard]] std::optional<Result> tune(const Topology& topology,
+                                             const CollectiveFactory& collectiveFactory,
+                                             ChunkSize bufferSize) const noexcept;
+
+    /// @brief Analytic lower bound on the collective time of any synthesized algorithm
+    /// @details The bound is the largest of (i) the shortest-path time of every chunk
+    /// to each of its destinations, and (ii) the time for the ingress (resp. egress) links
+    /// of every NPU to carry the chunks it must receive (resp. send), given that a link
+    /// carries one chunk at a time. A chunk with a size of its own (see Collective::size)
+    /// counts as a fraction of a chunk of chunkSize: the smallest ratio of their link times.
+    /// @param topology target network topology
+    /// @param collective target collective pattern
+    /// @param chunkSize size of each chunk (in bytes)
+    /// @return lower bound on the collective time (in microseconds)
+    [[nodiscard]] static Time lowerBound(const Topology& topology,
+                                         const Collective& collective,
+                                         ChunkSize chunkSize) noexcept;
+
+  private:
+    /// @brief largest number of initial chunks per NPU to consider
+    int maxCollectivesCount_;
+
+    /// @brief synthesis-time budget (in milliseconds)
+    double budget_;
+};
+
+}  // namespace tacos
@@ -0,0 +1,73 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <tacos/collective/concurrent_collective.h>
+#include <tacos/event_queue/event_queue.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/topology.h>
+#include <tacos/writer/synthesis_result.h>
+#include <vector>
+
+namespace tacos {
+
+/// @brief Synthesize concurrent collectives jointly, on a single time-expanded network.
+/// @details All groups of a ConcurrentCollective are synthesized at once, so that their chunks
+/// compete for the links they share, and the joint schedule is then split into one schedule
+/// per group.
+class ConcurrentSynthesizer {
+  public:
+    using Time = EventQueue::Time;
+    using NpuID = Topology::NpuID;
+    using ChunkSize = Collective::ChunkSize;
+
+    /// @brief Outcome of a concurrent synthesis
+    struct Result {
+        /// @brief schedule of each group, over the NPUs of the topology and with the chunk IDs
+        /// of ConcurrentCollective::member (its collective time is the completion time)
+        std::vector<SynthesisResult> synthesisResults;
+
+        /// @brief completion time of each group (in microseconds)
+        std::vector<Time> completionTimes;
+
+        /// @brief completion time of the last group (in microseconds)
+        Time makespan;
+    };
+
+    /// @brief Get the synthesizer of the joint schedule, e.g., to set its policies or seed
+    /// @return synthesizer of the joint schedule
+    [[nodiscard]] Synthesizer& synthesizer() noexcept;
+
+    /// @brief Synthesize the concurrent collectives jointly
+    /// @param topology network topology
+    /// @param collective concurrent collectives
+    /// @param chunkSize size of each chunk (in bytes)
+    /// @return per-group schedules and completion times
+    [[nodiscard]] Result solve(const Topology& topology,
+                               const ConcurrentCollective& collective,
+                               ChunkSize chunkSize) noexcept;
+
+    /// @brief Split a joint schedule into one schedule per group
+    /// @param topology network topology
+    /// @param collective concurrent collectives
+    /// @param synthesisResult joint schedule of the concurrent collectives
+    /// @param reductionTime time to reduce a received partial chunk, if the groups reduce
+    /// (see Synthesizer::reductionTime)
+    /// @return per-group schedules and completion times
+    [[nodiscard]] static Result split(const Topology& topology,
+                                      const ConcurrentCollective& collective,
+                                      SynthesisResult& synthesisResult,
+                                      Time reductionTime = 0) noexcept;
+
+  private:
+    /// @brief synthesizer of the joint schedule
+    Synthesizer synthesizer_ = {};
+};
+
+}  // namespace tacos
@@ -0,0 +1,290 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <tacos/collective/collective.h>
+#include <tacos/event_queue/event_queue.h>
+#include <tacos/event_queue/timer.h>
+#include <tacos/topology/topology.h>
+#include <tacos/writer/synthesis_result.h>
+#include <utility>
+#include <vector>
+
+namespace tacos {
+
+/// @brief Exact branch-and-bound synthesizer for small fabrics.
+/// @details The search walks the same event-driven model as the Synthesizer: at every event
+/// (i.e., chunk arrival), each free link either starts sending a chunk its source holds and
+/// its destination lacks, or stays idle. Every schedule in which no transfer can start
+/// earlier is enumerated this way, so the best one found is optimal once the search is
+/// exhausted. The tree is pruned by:
+/// (i) an analytic lower bound, the latest shortest-path arrival of a missing chunk and the
+/// time the chunks missing in a cut (a single NPU, or a set of NPUs such as the half of a
+/// bisection) need to cross the links into it;
+/// (ii) symmetry breaking, as links are decided in a fixed order, a link left idle may not
+/// later send a chunk it could have sent already, and interchangeable chunks (same sources and
+/// destinations, in the same state) are branched on only once.
+/// The Synthesizer seeds the incumbent schedule, and the subtrees below a split depth are
+/// handed out to worker threads, which share the incumbent collective time.
+class ExactSynthesizer {
+  public:
+    using Time = EventQueue::Time;
+    using NpuID = Topology::NpuID;
+    using ChunkID = Collective::ChunkID;
+    using ChunkSize = Collective::ChunkSize;
+
+    /// @brief maximum number of NPUs of the topology
+    static constexpr int maxNpusCount = 16;
+
+    /// @brief Outcome of an exact synthesis
+    struct Result {
+        /// @brief best schedule found
+        SynthesisResult synthesisResult;
+
+        /// @brief true if the search was exhausted, i.e., the schedule is optimal
+        bool optimal;
+
+        /// @brief lower bound on the optimal collective time (in microseconds)
+        Time lowerBound;
+
+        /// @brief number of search-tree nodes visited
+        int64_t nodesCount;
+    };
+
+    /// @brief Construct an exact synthesizer
+    /// @param budget search-time budget (in milliseconds)
+    /// @param threadsCount number of worker threads
+    explicit ExactSynthesizer(double budget, int threadsCount = 1) noexcept;
+
+    /// @brief Synthesize an optimal schedule of a collective
+    /// @param topology network topology (at most maxNpusCount NPUs)
+    /// @param collective collective pattern to synthesize (not a reduction, uniform chunk sizes,
+    /// all released at time 0)
+    /// @param chunkSize size of each chunk (in bytes)
+    /// @return best schedule found within the budget,
+    /// std::nullopt if the topology is too large or no schedule has been found
+    [[nodiscard]] std::optional<Result> solve(const Topology& topology,
+                                              const Collective& collective,
+                                              ChunkSize chunkSize) noexcept;
+
+  private:
+    /// @brief bitmask of NPUs
+    using NpuMask = uint32_t;
+
+    /// @brief A completed chunk transfer
+    struct Transfer {
+        /// @brief source NPU ID
+        NpuID src;
+
+        /// @brief destination NPU ID
+        NpuID dest;
+
+        /// @brief transferred chunk ID
+        ChunkID chunk;
+
+        /// @brief arrival time of the chunk at dest (in microseconds)
+        Time end;
+    };
+
+    /// @brief A link of the topology, along with its search state
+    struct Link {
+        /// @brief source NPU ID
+        NpuID src;
+
+        /// @brief destination NPU ID
+        NpuID dest;
+
+        /// @brief chunk transfer time (in microseconds)
+        Time duration;
+
+        /// @brief arrival time of the chunk in flight (negative if the link is free)
+        Time busyUntil;
+
+        /// @brief chunk in flight (negative if the link is free)
+        ChunkID chunk;
+
+        /// @brief time since which the link has been left idle (negative if not idle)
+        Time idleSince;
+    };
+
+    /// @brief Search state of a worker thread
+    struct State {
+        /// @brief current event time (in microseconds)
+        Time time;
+
+        /// @brief links of the topology
+        std::vector<Link> links;
+
+        /// @brief NPUs holding each chunk
+        std::vector<NpuMask> holders;
+
+        /// @brief NPUs each chunk is in flight to
+        std::vector<NpuMask> incoming;
+
+        /// @brief arrival time of chunk c at NPU n, if n holds it or it is in flight to n:
+        /// arrivals[c * npusCount + n]
+        std::vector<Time> arrivals;
+
+        /// @brief number of unsatisfied postconditions
+        int remaining;
+
+        /// @brief completed transfers, in their order of arrival
+        std::vector<Transfer> transfers;
+
+        /// @brief number of nodes visited
+        int64_t nodesCount;
+
+        /// @brief number of nodes at the split depth met so far
+        int64_t splitNodesCount;
+
+        /// @brief index of the split-depth node claimed by this worker
+        int64_t ticket;
+
+        /// @brief depth at which nodes are counted instead of searched (negative if none)
+        int countDepth;
+
+        /// @brief timer of the search budget, started with the synthesis
+        Timer timer;
+    };
+
+    /// @brief search-time budget (in milliseconds)
+    double budget_;
+
+    /// @brief number of worker threads
+    int threadsCount_;
+
+    /// @brief number of NPUs
+    int npusCount_ = 0;
+
+    /// @brief number of chunks
+    int chunksCount_ = 0;
+
+    /// @brief destination NPUs of each chunk
+    std::vector<NpuMask> destinations_ = {};
+
+    /// @brief lowest chunk ID with the same precondition and postcondition as each chunk
+    std::vector<ChunkID> classes_ = {};
+
+    /// @brief shortest-path chunk transfer times: pathTimes_[src][dest]
+    std::vector<std::vector<Time>> pathTimes_ = {};
+
+    /// @brief sets of NPUs whose ingress links bound the search
+    std::vector<NpuMask> cuts_ = {};
+
+    /// @brief indices of the links into each cut
+    std::vector<std::vector<int>> cutLinks_ = {};
+
+    /// @brief depth below which the subtrees are handed out to the workers (negative if none)
+    int splitDepth_ = -1;
+
+    /// @brief next split-depth node to be claimed
+    std::atomic<int64_t> nextTicket_ = 0;
+
+    /// @brief true once the search budget has run out
+    std::atomic<bool> stopped_ = false;
+
+    /// @brief collective time of the incumbent schedule
+    std::atomic<Time> bestTime_ = 0;
+
+    /// @brief transfers of the incumbent schedule
+    std::vector<Transfer> bestTransfers_ = {};
+
+    /// @brief mutex guarding bestTransfers_
+    std::mutex mutex_ = {};
+
+    /// @brief Build the initial search state
+    /// @param topology network topology
+    /// @param collective collective pattern
+    /// @param chunkSize size of each chunk (in bytes)
+    /// @return state at time 0
+    [[nodiscard]] State root_(const Topology& topology,
+                              const Collective& collective,
+                              ChunkSize chunkSize) noexcept;
+
+    /// @brief Seed the incumbent with the schedules of the Synthesizer
+    /// @param topology network topology
+    /// @param collective collective pattern
+    /// @param chunkSize size of each chunk (in bytes)
+    /// @param root initial search state
+    void seed_(const Topology& topology,
+               const Collective& collective,
+               ChunkSize chunkSize,
+               const State& root) noexcept;
+
+    /// @brief Replay the transfers of a synthesis result in the search model
+    /// @param synthesisResult schedule to replay
+    /// @param root initial search state
+    /// @return transfers of the schedule,
+    /// or std::nullopt if a chunk is sent before it arrives at its source
+    [[nodiscard]] std::optional<std::vector<Transfer>> replay_(SynthesisResult& synthesisResult,
+                                                               const State& root) const noexcept;
+
+    /// @brief Search the subtree of a node
+    /// @details The links of the current event are decided in order of their indices.
+    /// @param state search state of the node
+    /// @param depth depth of the node
+    /// @param first index of the first link not yet decided at the current event
+    void search_(State& state, int depth, int first) noexcept;
+
+    /// @brief Advance to the next event, delivering the chunks arriving then
+    /// @param state search state of the node
+    /// @param depth depth of the node
+    void advance_(State& state, int depth) noexcept;
+
+    /// @brief Chunks a link may start sending at the current event
+    /// @param state search state of the node
+    /// @param link link index
+    /// @return (lateness, chunk ID) pairs of the candidate chunks, punctual and rare ones first,
+    /// where the lateness is the delay of the arrival over the shortest path of the chunk
+    [[nodiscard]] std::vector<std::pair<Time, ChunkID>> candidates_(const State& state,
+                                                                    int link) const noexcept;
+
+    /// @brief Lower bound on the collective time of any schedule below a node
+    /// @param state search state of the node
+    /// @return lower bound (in microseconds)
+    [[nodiscard]] Time bound_(const State& state) const noexcept;
+
+    /// @brief Lower bound on the time the missing chunks of a cut need to cross into it
+    /// @param state search state of the node
+    /// @param cut set of NPUs
+    /// @param links indices of the links into the cut
+    /// @return lower bound (in microseconds)
+    [[nodiscard]] Time cutBound_(const State& state,
+                                 NpuMask cut,
+                                 const std::vector<int>& links) const noexcept;
+
+    /// @brief Select the cuts bounding the search: every NPU, and the tightest other cuts
+    /// @param root initial search state
+    void selectCuts_(const State& root) noexcept;
+
+    /// @brief Offer a complete schedule as the new incumbent
+    /// @param state search state of the complete schedule
+    void offer_(const State& state) noexcept;
+
+    /// @brief Count the nodes of the search tree at a given depth
+    /// @param root initial search state
+    /// @param depth depth to count the nodes at
+    /// @return number of nodes
+    [[nodiscard]] int64_t count_(const State& root, int depth) noexcept;
+
+    /// @brief Write a list of transfers into a new synthesis result
+    /// @param topology network topology
+    /// @param collective collective pattern
+    /// @param transfers transfers, in their order of arrival
+    /// @return synthesis result
+    [[nodiscard]] static SynthesisResult result_(const Topology& topology,
+                                                 const Collective& collective,
+                                                 const std::vector<Transfer>& transfers) noexcept;
+};
+
+}  // namespace tacos
@@ -0,0 +1,161 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <random>
+#include <tacos/collective/collective.h>
+#include <tacos/event_queue/event_queue.h>
+#include <tacos/topology/topology.h>
+#include <tacos/writer/synthesis_result.h>
+#include <utility>
+#include <vector>
+
+namespace tacos {
+
+/// @brief Post-synthesis local search shortening the critical path of a schedule.
+/// @details The schedule is modeled as a graph of chunk transfers, where a transfer starts
+/// as soon as its link is done with the previous transfer and its chunk has arrived at its
+/// source. Moves are drawn on the critical path (the chain of transfers that sets the
+/// collective time): a transfer is either moved ahead of the previous transfer of its link,
+/// or rerouted to another link into the same destination whose source receives the chunk.
+/// Only the transfers downstream of a move are re-timed, and a move is accepted if it
+/// shortens the collective time or the number of transfers finishing at the collective time.
+/// Moves that change neither are accepted with a probability that cools down over the budget,
+/// as in simulated annealing, so that the search can cross plateaus.
+class LocalSearch {
+  public:
+    using Time = EventQueue::Time;
+    using NpuID = Topology::NpuID;
+    using ChunkID = Collective::ChunkID;
+    using ChunkSize = Collective::ChunkSize;
+
+    /// @brief Construct a local search
+    /// @param budget search-time budget (in milliseconds)
+    explicit LocalSearch(double budget) noexcept;
+
+    /// @brief Reseed the random engine drawing the moves
+    /// @param seed random seed
+    void seed(std::mt19937::result_type seed) noexcept;
+
+    /// @brief Improve a synthesized schedule
+    /// @details The synthesis result is replaced only if the collective time shrinks.
+    /// @param topology network topology of the schedule
+    /// @param collective collective pattern of the schedule (not a reduction, uniform chunk sizes,
+    /// all released at time 0)
+    /// @param chunkSize size of each chunk (in bytes)
+    /// @param synthesisResult schedule to improve (in place)
+    /// @return true if the schedule has been improved, false otherwise
+    [[nodiscard]] bool improve(const Topology& topology,
+                               const Collective& collective,
+                               ChunkSize chunkSize,
+                               SynthesisResult& synthesisResult) noexcept;
+
+  private:
+    /// @brief A chunk transfer of the schedule
+    struct Transfer {
+        /// @brief source NPU ID
+        NpuID src;
+
+        /// @brief destination NPU ID
+        NpuID dest;
+
+        /// @brief transferred chunk ID
+        ChunkID chunk;
+
+        /// @brief link transfer time (in microseconds)
+        Time duration;
+
+        /// @brief arrival time of the chunk at dest (in microseconds)
+        Time end;
+
+        /// @brief index of the transfer in the sequence of its link
+        int position;
+    };
+
+    /// @brief search-time budget (in milliseconds)
+    double budget_;
+
+    /// @brief random engine drawing the moves
+    std::mt19937 randomEngine_{std::random_device{}()};
+
+    /// @brief number of NPUs
+    int npusCount_ = 0;
+
+    /// @brief link transfer time of a chunk: linkTimes_[src][dest] (negative if no link)
+    std::vector<std::vector<Time>> linkTimes_ = {};
+
+    /// @brief NPUs initially holding every chunk (i.e., its precondition and replicas):
+    /// sources_[chunk][npu]
+    std::vector<std::vector<bool>> sources_ = {};
+
+    /// @brief transfers of the schedule
+    std::vector<Transfer> transfers_ = {};
+
+    /// @brief transfers of every link, in order: links_[src][dest]
+    std::vector<std::vector<std::vector<int>>> links_ = {};
+
+    /// @brief transfer delivering chunk c to NPU n: deliverers_[c][n] (-1 if none)
+    std::vector<std::vector<int>> deliverers_ = {};
+
+    /// @brief transfers sending chunk c out of NPU n: senders_[c][n]
+    std::vector<std::vector<std::vector<int>>> senders_ = {};
+
+    /// @brief (transfer, previous arrival time) pairs changed by the ongoing move
+    std::vector<std::pair<int, Time>> undoLog_ = {};
+
+    /// @brief Build the transfer graph of a schedule
+    /// @param topology network topology of the schedule
+    /// @param collective collective pattern of the schedule
+    /// @param chunkSize size of each chunk (in bytes)
+    /// @param synthesisResult schedule
+    void build_(const Topology& topology,
+                const Collective& collective,
+                ChunkSize chunkSize,
+                SynthesisResult& synthesisResult) noexcept;
+
+    /// @brief Earliest start time of a transfer, given its predecessors
+    /// @param transfer transfer index
+    /// @return start time (in microseconds)
+    [[nodiscard]] Time start_(int transfer) const noexcept;
+
+    /// @brief Re-time the transfers downstream of the given ones
+    /// @param seeds transfers whose predecessors changed
+    /// @param limit arrival time beyond which the move is abandoned
+    /// @return true if every re-timed transfer arrives by limit, false otherwise
+    [[nodiscard]] bool retime_(const std::vector<int>& seeds, Time limit) noexcept;
+
+    /// @brief Restore the arrival times changed since the undo log was cleared
+    void undo_() noexcept;
+
+    /// @brief Collective time and number of transfers arriving at it
+    /// @return (collective time, number of critical transfers)
+    [[nodiscard]] std::pair<Time, int> makespan_() const noexcept;
+
+    /// @brief Draw a transfer on a critical path
+    /// @param makespan current collective time
+    /// @return transfer index
+    [[nodiscard]] int criticalTransfer_(Time makespan) noexcept;
+
+    /// @brief Move a transfer to another position of another (or the same) link
+    /// @param transfer transfer index
+    /// @param src new source NPU ID
+    /// @param position new position in the sequence of the src -> dest link
+    /// (once the transfer is removed from its current link)
+    /// @return transfers whose predecessors changed
+    [[nodiscard]] std::vector<int> move_(int transfer, NpuID src, int position) noexcept;
+
+    /// @brief Write the schedule into a new synthesis result
+    /// @param topology network topology of the schedule
+    /// @param collective collective pattern of the schedule
+    /// @return synthesis result
+    [[nodiscard]] SynthesisResult result_(const Topology& topology,
+                                          const Collective& collective) const noexcept;
+};
+
+}  // namespace tacos
@@ -0,0 +1,70 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <tacos/collective/collective.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/topology.h>
+#include <tacos/writer/synthesis_result.h>
+#include <vector>
+
+namespace tacos {
+
+/// @brief Portfolio of synthesizer configurations raced in parallel on the same problem.
+/// @details Every configuration sets up its own synthesizer (built-in policies, or a custom
+/// SynthesisPolicy). All configurations synthesize concurrently, one thread each, and the race
+/// keeps the shortest collective time among the syntheses finished within the budget.
+class PolicyPortfolio {
+  public:
+    using ChunkSize = Collective::ChunkSize;
+
+    /// @brief Set up the policies of a synthesizer
+    using Configuration = std::function<void(Synthesizer&)>;
+
+    /// @brief Outcome of a race
+    struct Result {
+        /// @brief index of the winning configuration
+        int winner;
+
+        /// @brief synthesis result of the winning configuration
+        SynthesisResult synthesisResult;
+    };
+
+    /// @brief Construct an empty portfolio
+    PolicyPortfolio() noexcept;
+
+    /// @brief Construct the portfolio of the built-in matching policies
+    /// @details random (index 0), greedy (index 1), and lookahead (index 2).
+    /// @return built-in portfolio
+    [[nodiscard]] static PolicyPortfolio builtIn() noexcept;
+
+    /// @brief Add a configuration to the portfolio
+    /// @param configuration sets up the policies of a synthesizer
+    /// @return index of the configuration
+    int add(Configuration configuration) noexcept;
+
+    /// @brief Race all configurations on the same problem
+    /// @param topology target network topology
+    /// @param collective target collective pattern
+    /// @param chunkSize size of each chunk (in bytes)
+    /// @param budget synthesis-time budget (in milliseconds)
+    /// @return best synthesis, or std::nullopt if none finished within the budget
+    [[nodiscard]] std::optional<Result> race(const Topology& topology,
+                                             const Collective& collective,
+                                             ChunkSize chunkSize,
+                                             double budget) const noexcept;
+
+  private:
+    /// @brief configurations to race
+    std::vector<Configuration> configurations_ = {};
+};
+
+}  // namespace tacos
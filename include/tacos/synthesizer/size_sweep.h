@@ -0,0 +1,73 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <random>
+#include <tacos/collective/collective.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/topology.h>
+#include <tacos/writer/synthesis_result.h>
+#include <vector>
+
+namespace tacos {
+
+/// @brief Synthesize a collective across a range of buffer sizes.
+/// @details Buffer sizes are swept geometrically from minBytes up to maxBytes,
+/// and each swept size s stands for the buffer sizes in [s, s * factor).
+/// Consecutive sizes yielding the same schedule are merged into a single range,
+/// so that the runtime can pick the algorithm to run per message size.
+class SizeSweep {
+  public:
+    using ChunkSize = Collective::ChunkSize;
+
+    /// @brief A range of buffer sizes sharing the same synthesized schedule
+    struct Range {
+        /// @brief smallest buffer size of the range (in bytes, inclusive)
+        ChunkSize minBytes;
+
+        /// @brief largest buffer size of the range (in bytes, exclusive)
+        ChunkSize maxBytes;
+
+        /// @brief synthesized algorithm, at the smallest buffer size of the range
+        SynthesisResult result;
+    };
+
+    /// @brief Construct a sweep over buffer sizes
+    /// @param minBytes smallest buffer size (in bytes)
+    /// @param maxBytes largest buffer size to sweep (in bytes)
+    /// @param factor ratio between two consecutive swept sizes
+    SizeSweep(ChunkSize minBytes, ChunkSize maxBytes, int factor = 2) noexcept;
+
+    /// @brief Synthesize the collective at every swept buffer size
+    /// @details Every size is synthesized with the same random seed by the same synthesizer,
+    /// which reuses its time-expanded network: only the link transfer times change.
+    /// @param topology target network topology
+    /// @param collective target collective pattern
+    /// @return ranges of buffer sizes, in increasing order
+    [[nodiscard]] std::vector<Range> solve(const Topology& topology,
+                                           const Collective& collective) noexcept;
+
+  private:
+    /// @brief smallest buffer size (in bytes)
+    ChunkSize minBytes_;
+
+    /// @brief largest buffer size to sweep (in bytes)
+    ChunkSize maxBytes_;
+
+    /// @brief ratio between two consecutive swept sizes
+    int factor_;
+
+    /// @brief synthesizer reused across buffer sizes
+    Synthesizer synthesizer_ = {};
+
+    /// @brief random seed shared by all buffer sizes of a sweep
+    std::mt19937::result_type seed_ = std::random_device{}();
+};
+
+}  // namespace tacos
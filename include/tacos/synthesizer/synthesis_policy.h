@@ -0,0 +1,89 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <random>
+#include <tacos/collective/collective.h>
+#include <tacos/event_queue/event_queue.h>
+#include <tacos/synthesizer/time_expanded_network.h>
+#include <tacos/topology/topology.h>
+#include <utility>
+#include <vector>
+
+namespace tacos {
+
+/// @brief User-defined heuristics driving the decisions of the synthesizer.
+/// @details Override any of the hooks to plug a custom heuristic into the synthesis engine
+/// (see Synthesizer::policy). The default implementation of every hook makes a random
+/// choice, i.e., it behaves like the built-in random policies.
+class SynthesisPolicy {
+  public:
+    using Time = EventQueue::Time;
+    using NpuID = Topology::NpuID;
+    using ChunkID = Collective::ChunkID;
+
+    /// @brief A condition: (chunkID, NpuID) pair
+    using Condition = std::pair<ChunkID, NpuID>;
+
+    /// @brief Read-only view of the ongoing synthesis handed to the hooks.
+    struct State {
+        /// @brief Target network topology
+        const Topology& topology;
+
+        /// @brief Target collective pattern
+        const Collective& collective;
+
+        /// @brief Time-expanded network (link availability and chunks in flight)
+        const TimeExpandedNetwork& ten;
+
+        /// @brief true if chunk c has arrived at NPU n: chunkMap[c][n]
+        const std::vector<std::vector<bool>>& chunkMap;
+
+        /// @brief number of NPUs holding chunk c: replicas[c]
+        const std::vector<int>& replicas;
+
+        /// @brief hop distance between NPUs: hops[src][dest] (-1 if unreachable)
+        const std::vector<std::vector<int>>& hops;
+
+        /// @brief current synthesis time (in microseconds)
+        Time currentTime;
+
+        /// @brief random engine of the synthesizer (seeded by Synthesizer::seed)
+        std::mt19937& randomEngine;
+    };
+
+    virtual ~SynthesisPolicy() noexcept;
+
+    /// @brief Order the unsatisfied postconditions claiming links at the current event.
+    /// @param state synthesis state
+    /// @param postcondition unsatisfied postconditions (shuffled), to reorder in place
+    virtual void orderPostconditions(const State& state,
+                                     std::vector<Condition>& postcondition) noexcept;
+
+    /// @brief Select the source NPU of a chunk among the earliest-arrival candidates.
+    /// @param state synthesis state
+    /// @param chunk chunk ID being matched
+    /// @param dest destination NPU ID
+    /// @param candidates candidate source NPUs (not empty)
+    /// @return selected source NPU (one of the candidates)
+    [[nodiscard]] virtual NpuID selectSource(const State& state,
+                                             ChunkID chunk,
+                                             NpuID dest,
+                                             const std::vector<NpuID>& candidates) noexcept;
+
+    /// @brief Select the replacement chunk of a redundant transfer.
+    /// @param state synthesis state
+    /// @param src source NPU ID
+    /// @param dest destination NPU ID
+    /// @param candidates candidate chunks held by src and needed by dest (not empty)
+    /// @return selected replacement chunk (one of the candidates)
+    [[nodiscard]] virtual ChunkID selectReplacement(
+        const State& state, NpuID src, NpuID dest, const std::vector<ChunkID>& candidates) noexcept;
+};
+}  // namespace tacos
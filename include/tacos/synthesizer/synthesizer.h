@@ -10,12 +10,16 @@ Copyright (c) 2022-2025 Georgia Institute of Technology
 
 #include <algorithm>
 #include <array>
+#include <functional>
+#include <future>
 #include <memory>
 #include <optional>
 #include <random>
 #include <set>
 #include <tacos/collective/collective.h>
 #include <tacos/event_queue/event_queue.h>
+#include <tacos/synthesizer/cancellation_token.h>
+#include <tacos/synthesizer/synthesis_policy.h>
 #include <tacos/synthesizer/time_expanded_network.h>
 #include <tacos/topology/topology.h>
 #include <tacos/writer/synthesis_result.h>
@@ -33,6 +37,58 @@ class Synthesizer {
     using ChunkID = Collective::ChunkID;
     using ChunkSize = Collective::ChunkSize;
 
+    /// @brief Snapshot of an ongoing synthesis, reported to a progress callback.
+    struct Progress {
+        /// @brief Current synthesis time (in microseconds)
+        Time currentTime;
+
+        /// @brief Number of (chunk, dest) postconditions already satisfied
+        int satisfiedPostconditions;
+
+        /// @brief Number of (chunk, dest) postconditions not yet satisfied
+        int remainingPostconditions;
+
+        /// @brief Number of events processed so far
+        int eventsProcessed;
+    };
+
+    /// @brief Callback periodically invoked with the synthesis progress.
+    using ProgressCallback = std::function<void(const Progress&)>;
+
+    /// @brief Policy to select the source NPU among the earliest-arrival candidates.
+    enum class MatchingPolicy {
+        /// @brief Pick a candidate uniformly at random.
+        Random,
+
+        /// @brief Pick the candidate with the most free egress links (the least loaded sender),
+        /// breaking ties at random.
+        Greedy,
+
+        /// @brief Pick the candidate whose link is the least needed by other unsatisfied chunks
+        /// (one-step lookahead), breaking ties at random.
+        Lookahead
+    };
+
+    /// @brief Policy to order the unsatisfied (chunk, dest) postconditions claiming links.
+    enum class OrderingPolicy {
+        /// @brief Serve the postconditions in a random order.
+        Random,
+
+        /// @brief Serve first the postconditions farthest from the nearest holder of their chunk
+        /// (by hops, then by path latency), breaking ties at random.
+        DistancePriority
+    };
+
+    /// @brief Policy to choose the replacement chunk of a redundant transfer.
+    enum class ReplacementPolicy {
+        /// @brief Pick a candidate chunk uniformly at random.
+        Random,
+
+        /// @brief Pick the candidate chunk currently held by the fewest NPUs,
+        /// breaking ties at random.
+        RarestFirst
+    };
+
     /// @brief Default constructor for the synthesizer.
     Synthesizer() noexcept;
 
@@ -45,6 +101,103 @@ class Synthesizer {
                                         const Collective& collective,
                                         ChunkSize chunkSize) noexcept;
 
+    /// @brief Set the source selection policy of the link-chunk matching.
+    /// @param policy matching policy (MatchingPolicy::Random by default)
+    void matchingPolicy(MatchingPolicy policy) noexcept;
+
+    /// @brief Set the order in which unsatisfied postconditions claim links.
+    /// @param policy ordering policy (OrderingPolicy::Random by default)
+    void orderingPolicy(OrderingPolicy policy) noexcept;
+
+    /// @brief Set how the replacement chunk of a redundant transfer is chosen.
+    /// @param policy replacement policy (ReplacementPolicy::Random by default)
+    void replacementPolicy(ReplacementPolicy policy) noexcept;
+
+    /// @brief Fill the links left idle by the matching with speculative relay transfers.
+    /// @details An idle link forwards a chunk its source holds if its destination is strictly
+    /// closer (in hops) to an unsatisfied destination of the chunk than every current holder
+    /// and receiver of the chunk, preferring the rarest chunks, then the largest progress.
+    /// A speculative transfer that is useless on arrival is replaced like a redundant one
+    /// (see findReplacementChunk_) or dropped, so it never appears in the synthesis result.
+    /// @param maxInFlight maximum number of speculative transfers in flight (0: disabled)
+    void speculativeRelay(int maxInFlight) noexcept;
+
+    /// @brief Plug a custom heuristic into the synthesis engine.
+    /// @details While a custom policy is set, its hooks order the postconditions and select
+    /// the sources and replacement chunks, and the built-in policies above are ignored.
+    /// Without one (the default), the built-in policies are inlined in the engine
+    /// without any virtual dispatch.
+    /// @param policy custom policy (nullptr to restore the built-in policies)
+    void policy(std::shared_ptr<SynthesisPolicy> policy) noexcept;
+
+    /// @brief Synthesize with a beam search instead of a single randomized pass.
+    /// @details At every event time, each of the beamWidth best partial schedules with an
+    /// event then is expanded branchingFactor times (each expansion drawing its own random
+    /// choices). The beamWidth distinct partial schedules with the lowest bound on their
+    /// collective time (the shortest-path arrival of their last unsatisfied postcondition),
+    /// then with the lowest sum of such arrivals over all unsatisfied postconditions
+    /// (which rewards satisfied demand), make the next beam. Partial schedules share the
+    /// transfers of their common past, so copying one does not copy its history.
+    /// @param beamWidth number of partial schedules kept at every event (0: disabled)
+    /// @param branchingFactor number of expansions of every partial schedule
+    void beamSearch(int beamWidth, int branchingFactor = 2) noexcept;
+
+    /// @brief Set the compute cost of reducing a received partial chunk (per hop).
+    /// @details Reduction collectives (see Collective::reduction) are synthesized as their
+    /// dual collective, whose schedule is reversed in time (see TimeReversal). Each partial
+    /// chunk received is then reduced in latency + chunkSize / bandwidth microseconds.
+    /// @param bandwidth reduction bandwidth in GiB/sec (0: reductions take no time)
+    /// @param latency reduction latency in microseconds
+    void reductionCost(Topology::Bandwidth bandwidth, Topology::Latency latency = 0) noexcept;
+
+    /// @brief Get the time to reduce a received partial chunk (see reductionCost)
+    /// @param chunkSize size of each chunk (in bytes)
+    /// @return reduction time of a partial chunk (in microseconds)
+    [[nodiscard]] Time reductionTime(ChunkSize chunkSize) const noexcept;
+
+    /// @brief Keep the links busy until given times, e.g., with the transfers of earlier
+    /// collectives (see WorkloadSynthesizer).
+    /// @details No transfer is scheduled over the src-dest link before linksBusyUntil[src][dest]
+    /// (in microseconds). Reduction collectives start their reversed schedule on every link
+    /// once it is free. This applies to every following synthesis.
+    /// @param linksBusyUntil time until which each link is busy (empty: all links are free)
+    void linksBusyUntil(std::vector<std::vector<Time>> linksBusyUntil) noexcept;
+
+    /// @brief Issue the collectives at a given time, e.g., once the collectives they depend on
+    /// are complete (see WorkloadSynthesizer).
+    /// @details The release times of the chunks (see Collective::releaseTime) are relative to
+    /// the issue time, so that no chunk is released before it. This applies to every
+    /// following synthesis.
+    /// @param issueTime issue time of the collectives (in microseconds, 0 by default)
+    void issueTime(Time issueTime) noexcept;
+
+    /// @brief Reseed the random engine used for tie-breaking.
+    /// @details Synthesizing with the same seed over equivalent event orders
+    /// (e.g., chunk sizes that scale all link times alike) yields the same schedule.
+    /// @param seed random seed
+    void seed(std::mt19937::result_type seed) noexcept;
+
+    /// @brief Run TACOS synthesis process asynchronously.
+    /// @details The synthesis runs on a separate thread, checks the cancellation token
+    /// once per event, and invokes the progress callback every progressInterval events
+    /// (and once more when the synthesis finishes).
+    /// The topology, the collective, and this synthesizer must outlive the returned future,
+    /// and the synthesizer must not be used by other calls until the future is ready.
+    /// @param topology Target network topology
+    /// @param collective Target collective pattern
+    /// @param chunkSize Size of each chunk (in bytes)
+    /// @param cancellationToken Token to abort the synthesis
+    /// @param progressCallback Callback to report the synthesis progress (optional)
+    /// @param progressInterval Number of events between two progress reports
+    /// @return future holding the SynthesisResult, or std::nullopt if the synthesis was cancelled
+    [[nodiscard]] std::future<std::optional<SynthesisResult>> solveAsync(
+        const Topology& topology,
+        const Collective& collective,
+        ChunkSize chunkSize,
+        CancellationToken cancellationToken,
+        ProgressCallback progressCallback = nullptr,
+        int progressInterval = 1) noexcept;
+
   private:
     /// @brief Map of destination NPU -> set of unsatisfied chunk IDs.
     using PostconditionMap = std::unordered_map<NpuID, std::unordered_set<ChunkID>>;
@@ -52,6 +205,63 @@ class Synthesizer {
     /// @brief A condition: (chunkID, NpuID) pair
     using Condition = std::pair<ChunkID, NpuID>;
 
+    /// @brief A chunk transfer recorded during the beam search
+    struct Transfer {
+        /// @brief source NPU ID
+        NpuID src;
+
+        /// @brief destination NPU ID
+        NpuID dest;
+
+        /// @brief transferred chunk ID
+        ChunkID chunk;
+
+        /// @brief arrival time of the chunk at dest
+        Time time;
+    };
+
+    /// @brief Transfers of an event, linked to the (shared) transfers of the previous events
+    struct TransferLog {
+        /// @brief log of the previous event (nullptr if none)
+        std::shared_ptr<const TransferLog> previous;
+
+        /// @brief transfers arrived at this event
+        std::vector<Transfer> transfers;
+    };
+
+    /// @brief Copy of the synthesis state, i.e., a partial schedule of the beam search
+    struct Snapshot {
+        /// @brief pending events
+        EventQueue eventQueue;
+
+        /// @brief state of the TEN links
+        TimeExpandedNetwork ten;
+
+        /// @brief chunk map (see chunkMap_)
+        std::vector<std::vector<bool>> chunkMap;
+
+        /// @brief replica counts (see replicas_)
+        std::vector<int> replicas;
+
+        /// @brief speculative links (see speculative_)
+        std::vector<std::vector<bool>> speculative;
+
+        /// @brief number of speculative transfers in flight
+        int speculativeTransfers;
+
+        /// @brief number of released chunks (see releasedCount_)
+        int releasedCount;
+
+        /// @brief current time
+        Time currentTime;
+
+        /// @brief collective time so far
+        Time collectiveTime;
+
+        /// @brief transfers made so far
+        std::shared_ptr<const TransferLog> transferLog;
+    };
+
     /// @brief Target network topology.
     const Topology* topology_ = nullptr;
 
@@ -64,6 +274,9 @@ class Synthesizer {
     /// @brief Number of chunks in the collective pattern.
     int chunksCount_ = -1;
 
+    /// @brief Total number of (chunk, dest) postconditions in the collective pattern.
+    int postconditionsCount_ = -1;
+
     /// @brief Current time in the synthesizer.
     Time currentTime_ = -1;
 
@@ -76,15 +289,88 @@ class Synthesizer {
     /// @brief Time-expanded network to model the topology over time.
     std::unique_ptr<TimeExpandedNetwork> ten_ = nullptr;
 
+    /// @brief Generation of the topology the TEN was constructed from.
+    uint64_t tenGeneration_ = 0;
+
     /// @brief true if chunk c has arrived at NPU n: chunkMap_[c][n] = true
     std::vector<std::vector<bool>> chunkMap_ = {};
 
+    /// @brief number of NPUs holding chunk c: replicas_[c], maintained along chunkMap_
+    std::vector<int> replicas_ = {};
+
     /// @brief Synthesis result to track communication operations for XML generation
     std::unique_ptr<SynthesisResult> synthesisResult_ = nullptr;
 
     /// @brief Random number generator engine
     std::mt19937 randomEngine{std::random_device{}()};
 
+    /// @brief Source selection policy of the link-chunk matching.
+    MatchingPolicy matchingPolicy_ = MatchingPolicy::Random;
+
+    /// @brief Order in which unsatisfied postconditions claim links.
+    OrderingPolicy orderingPolicy_ = OrderingPolicy::Random;
+
+    /// @brief Choice of the replacement chunk of a redundant transfer.
+    ReplacementPolicy replacementPolicy_ = ReplacementPolicy::Random;
+
+    /// @brief Custom heuristic replacing the built-in policies (nullptr if none).
+    std::shared_ptr<SynthesisPolicy> policy_ = nullptr;
+
+    /// @brief Maximum number of speculative relay transfers in flight (0: disabled).
+    int maxSpeculativeTransfers_ = 0;
+
+    /// @brief Number of speculative relay transfers currently in flight.
+    int speculativeTransfers_ = 0;
+
+    /// @brief true if the transfer over the src-dest link is speculative: speculative_[src][dest]
+    std::vector<std::vector<bool>> speculative_ = {};
+
+    /// @brief Number of partial schedules kept by the beam search (0: disabled).
+    int beamWidth_ = 0;
+
+    /// @brief Number of expansions of every partial schedule of the beam search.
+    int branchingFactor_ = 2;
+
+    /// @brief Reduction bandwidth in GiB/sec (0: reductions take no time).
+    Topology::Bandwidth reductionBandwidth_ = 0;
+
+    /// @brief Reduction latency in microseconds.
+    Topology::Latency reductionLatency_ = 0;
+
+    /// @brief Time until which each link is busy before the synthesis (empty: all links free).
+    std::vector<std::vector<Time>> linksBusyUntil_ = {};
+
+    /// @brief Issue time of the collectives, to which the chunk release times are relative.
+    Time issueTime_ = 0;
+
+    /// @brief Transfers of the partial schedule being expanded (beam search only, else nullptr)
+    std::shared_ptr<TransferLog> transferLog_ = nullptr;
+
+    /// @brief Shortest-path chunk transfer time between NPUs: pathTimes_[src][dest]
+    /// (computed for the beam search and relayed collectives)
+    std::vector<std::vector<Time>> pathTimes_ = {};
+
+    /// @brief true if some chunks must be relayed through NPUs outside their postcondition
+    bool relayed_ = false;
+
+    /// @brief chunks released after time 0, in their order of release
+    /// (empty for reductions, whose release times are enforced by the TimeReversal)
+    std::vector<ChunkID> releaseOrder_ = {};
+
+    /// @brief number of chunks of releaseOrder_ released so far
+    int releasedCount_ = 0;
+
+    /// @brief true if the chunks with earlier deadlines claim links first
+    bool prioritized_ = false;
+
+    /// @brief Hop distance between NPUs: hops_[src][dest]
+    /// (computed for non-random policies, custom policies, and speculative relay)
+    std::vector<std::vector<int>> hops_ = {};
+
+    /// @brief Minimum path latency between NPUs: pathLatencies_[src][dest]
+    /// (computed for the distance-priority ordering)
+    std::vector<std::vector<Topology::Latency>> pathLatencies_ = {};
+
     /// @brief Initialize the synthesizer with the given topology and collective.
     /// @param topology target network topology
     /// @param collective target collective pattern
@@ -93,14 +379,87 @@ class Synthesizer {
                      const Collective& collective,
                      ChunkSize chunkSize) noexcept;
 
+    /// @brief Run the link-chunk matching process until all postconditions are satisfied.
+    /// @param cancellationToken token checked once per event (nullptr if not cancellable)
+    /// @param progressCallback callback to report the progress (nullptr if not reported)
+    /// @param progressInterval number of events between two progress reports
+    /// @return SynthesisResult, or std::nullopt if the synthesis was cancelled
+    [[nodiscard]] std::optional<SynthesisResult> synthesize_(
+        const CancellationToken* cancellationToken,
+        const ProgressCallback* progressCallback,
+        int progressInterval) noexcept;
+
+    /// @brief Reverse the schedule of the dual collective if the collective is a reduction.
+    /// @param synthesisResult schedule synthesized for collective_
+    /// @param chunkSize chunk size in bytes
+    /// @return schedule of collective_
+    [[nodiscard]] SynthesisResult reverse_(SynthesisResult synthesisResult,
+                                           ChunkSize chunkSize) const noexcept;
+
+    /// @brief Keep the beamWidth_ best partial schedules at every event, and return the best one.
+    /// @param cancellationToken token checked once per event (nullptr if not cancellable)
+    /// @param progressCallback callback to report the progress (nullptr if not reported)
+    /// @param progressInterval number of events between two progress reports
+    /// @return SynthesisResult, or std::nullopt if the synthesis was cancelled
+    [[nodiscard]] std::optional<SynthesisResult> beamSynthesize_(
+        const CancellationToken* cancellationToken,
+        const ProgressCallback* progressCallback,
+        int progressInterval) noexcept;
+
+    /// @brief Process the next event: expand the TEN, then match (and relay) chunks.
+    /// @return map of postconditions unsatisfied after the expansion of the TEN
+    PostconditionMap step_() noexcept;
+
+    /// @brief Copy the current synthesis state.
+    /// @return snapshot of the synthesis state
+    [[nodiscard]] Snapshot snapshot_() const noexcept;
+
+    /// @brief Restore a copied synthesis state.
+    /// @param snapshot snapshot of the synthesis state
+    void restore_(const Snapshot& snapshot) noexcept;
+
+    /// @brief Lower bound on the collective time of the current partial schedule.
+    /// @details Every unsatisfied postcondition is reached at the earliest through a shortest
+    /// path from a current holder of its chunk, or from the receiver of a transfer in flight
+    /// from such a holder (which a replacement may turn into a transfer of the chunk).
+    /// @param postconditionMap map of unsatisfied postconditions
+    /// @param totalArrival set to the sum of these earliest arrival times
+    /// @return lower bound on the collective time (in microseconds)
+    [[nodiscard]] Time bound_(const PostconditionMap& postconditionMap,
+                              Time* totalArrival) const noexcept;
+
+    /// @brief Record a chunk arrival in the synthesis result (or in the transfer log).
+    /// @param src source NPU ID
+    /// @param dest destination NPU ID
+    /// @param chunk arrived chunk ID
+    void recordTransfer_(NpuID src, NpuID dest, ChunkID chunk) noexcept;
+
+    /// @brief Report the current synthesis progress to the callback.
+    /// @param progressCallback callback to report the progress
+    /// @param postconditionMap map of unsatisfied postconditions
+    /// @param eventsProcessed number of events processed so far
+    void reportProgress_(const ProgressCallback& progressCallback,
+                         const PostconditionMap& postconditionMap,
+                         int eventsProcessed) const noexcept;
+
     /// @brief Mark chunks in precondition as already at their source NPUs.
+    /// @details Chunks released after time 0 are only marked once released.
     void markPrecondition_() noexcept;
 
+    /// @brief Mark the chunks released by the current time as at their source NPUs.
+    void releaseChunks_() noexcept;
+
+    /// @brief Mark a chunk as at its source NPU (and replicas).
+    /// @param chunk chunk ID
+    void markSources_(ChunkID chunk) noexcept;
+
     /// @brief Filter out chunks that have not yet arrived at their destination NPUs.
     /// @return map of destination NPUs -> set of chunks that have not yet arrived
     [[nodiscard]] PostconditionMap filterPostcondition_() const noexcept;
 
     /// @brief Flatten and shuffle the unsatisfied postcondition
+    /// @details With the distance-priority ordering, the shuffled postconditions are then
+    /// stably sorted by decreasing distance from the nearest holder of their chunk.
     /// @param postcondition filtered postcondition map
     /// @return shuffled vector of unsatisfied postconditions in (chunkID, NpuID) format
     [[nodiscard]] std::vector<Condition> shufflePostcondition_(
@@ -119,12 +478,17 @@ class Synthesizer {
     /// If so, instead of simply discarding the link-chunk matching,
     /// TACOS will try to find another chunk that's not satisfied yet, to maximize
     /// the network utilization.
+    /// A chunk with a size of its own is only replaced by chunks no larger than itself.
     /// @param src source NPU ID
     /// @param dest destination NPU ID
+    /// @param redundantChunk chunk that has already arrived at dest
     /// @param postconditionMap map of unsatisfied postconditions
     /// @return a replacement chunk ID if found, std::nullopt otherwise
     [[nodiscard]] std::optional<ChunkID> findReplacementChunk_(
-        NpuID src, NpuID dest, const PostconditionMap* postconditionMap) noexcept;
+        NpuID src,
+        NpuID dest,
+        ChunkID redundantChunk,
+        const PostconditionMap* postconditionMap) noexcept;
 
     /// @brief Make a link-chunk matching for a given chunk and destination NPU.
     /// @details This method will backtrack the source NPUs that can send the chunk to the
@@ -133,12 +497,69 @@ class Synthesizer {
     /// as occupied with transferring the chunk
     /// @param chunk chunk ID to transfer
     /// @param dest destination NPU ID
-    void linkChunkMatching_(ChunkID chunk, NpuID dest) noexcept;
+    /// @param postconditionMap map of unsatisfied postconditions
+    void linkChunkMatching_(ChunkID chunk,
+                            NpuID dest,
+                            const PostconditionMap& postconditionMap) noexcept;
+
+    /// @brief Select the source NPU of a link-chunk matching among the earliest-arriving ones.
+    /// @details The custom policy chooses if one is set, the matching policy otherwise.
+    /// @param chunk chunk ID to transfer
+    /// @param dest destination NPU ID
+    /// @param candidates source NPUs of the earliest chunk arrival (not empty)
+    /// @param postconditionMap map of unsatisfied postconditions
+    /// @return selected source NPU ID
+    [[nodiscard]] NpuID selectSource_(ChunkID chunk,
+                                      NpuID dest,
+                                      std::vector<NpuID> candidates,
+                                      const PostconditionMap& postconditionMap) noexcept;
+
+    /// @brief Transfer time of a chunk over a link, of its own size if it has one.
+    /// @param src source NPU ID
+    /// @param dest destination NPU ID
+    /// @param chunk chunk ID
+    /// @return chunk transfer time in microseconds
+    [[nodiscard]] Time transferTime_(NpuID src, NpuID dest, ChunkID chunk) const noexcept;
+
+    /// @brief Snapshot the synthesis state for the hooks of the custom policy.
+    /// @return read-only view of the synthesis state
+    [[nodiscard]] SynthesisPolicy::State state_() noexcept;
+
+    /// @brief Start speculative relay transfers over the links left idle by the matching.
+    /// @param postconditionMap map of unsatisfied postconditions
+    void relayIdleLinks_(const PostconditionMap& postconditionMap) noexcept;
+
+    /// @brief Relay the chunks none of whose holders neighbors an unsatisfied destination.
+    /// @details The link-chunk matching only delivers chunks to their destinations, which
+    /// suffices if the NPUs on the way need the chunk as well (e.g., AllGather). Otherwise
+    /// (e.g., AllToAll), unless the chunk is already in flight to an NPU closer to the
+    /// destination than all its holders, one of the closest holders forwards it to a free
+    /// neighbor on a shortest path to the destination.
+    /// @param postcondition shuffled unsatisfied postconditions
+    void relayChunks_(const std::vector<Condition>& postcondition) noexcept;
+
+    /// @brief Check if a chunk still has to reach any of its destination NPUs.
+    /// @param chunk chunk ID
+    /// @return true if some destination NPU of the chunk has not received it yet
+    [[nodiscard]] bool pending_(ChunkID chunk) const noexcept;
 
-    /// @brief Compare lhs and rhs Time values for equality
-    /// @param lhs Time value
-    /// @param rhs Time value
-    /// @return true if lhs and rhs are equal (epsilon 1e-9), false otherwise
-    [[nodiscard]] static bool isEqual(Time lhs, Time rhs) noexcept;
+    /// @brief Release time of a chunk, from the issue time of the collective.
+    /// @param chunk chunk ID
+    /// @return time at which the chunk is released at its source NPU (in microseconds)
+    [[nodiscard]] Time releaseTime_(ChunkID chunk) const noexcept;
+
+    /// @brief Estimate how much other unsatisfied chunks need the src -> dest link.
+    /// @details Every other chunk that dest still needs and src holds (and that is not
+    /// already on its way to dest) adds its hop distance from its nearest other holder,
+    /// divided by the number of other free links that could deliver it to dest right now.
+    /// @param src candidate source NPU ID
+    /// @param dest destination NPU ID
+    /// @param chunk chunk ID being matched
+    /// @param postconditionMap map of unsatisfied postconditions
+    /// @return lookahead cost of occupying the link (lower is better)
+    [[nodiscard]] double lookaheadCost_(NpuID src,
+                                        NpuID dest,
+                                        ChunkID chunk,
+                                        const PostconditionMap& postconditionMap) const noexcept;
 };
 }  // namespace tacos
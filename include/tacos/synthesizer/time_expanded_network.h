@@ -30,6 +30,12 @@ class TimeExpandedNetwork {
     /// @param topology target network topology
     TimeExpandedNetwork(const Topology& topology, ChunkSize chunkSize) noexcept;
 
+    /// @brief Reset the TEN for a new synthesis over the same topology
+    /// @details All links become free and the link transfer times are recomputed,
+    /// reusing the storage of the TEN lists across chunk sizes.
+    /// @param chunkSize chunk size in bytes
+    void reset(ChunkSize chunkSize) noexcept;
+
     /// @brief Check if a link is available at the current timestep
     /// @param src source NPU ID
     /// @param dest destination NPU ID
@@ -42,6 +48,19 @@ class TimeExpandedNetwork {
     /// @return chunk transfer time in microseconds (us)
     [[nodiscard]] Time linkTransferTime(NpuID src, NpuID dest) const noexcept;
 
+    /// @brief Retrieve the transfer time of a chunk of a given size between two NPUs
+    /// @details Used for the chunks with a size of their own (see Collective::size).
+    /// @param src source NPU ID
+    /// @param dest destination NPU ID
+    /// @param chunkSize chunk size in bytes
+    /// @return chunk transfer time in microseconds (us)
+    [[nodiscard]] Time linkTransferTime(NpuID src, NpuID dest, ChunkSize chunkSize) const noexcept;
+
+    /// @brief Compute the shortest-path chunk transfer time between every pair of NPUs
+    /// @return times[src][dest] = minimum total link transfer time of a path from src to dest
+    /// (0 if src == dest, std::numeric_limits<Time>::max() if unreachable)
+    [[nodiscard]] std::vector<std::vector<Time>> shortestPathTimes() const noexcept;
+
     /// @brief Backtrack the TEN and return the list of available source NPUs to dest
     /// @param dest destination NPU ID
     /// @return list of source NPUs available at current timestep
@@ -65,6 +84,12 @@ class TimeExpandedNetwork {
     /// @return chunk ID being transferred over the link
     [[nodiscard]] ChunkID chunk(NpuID src, NpuID dest) const noexcept;
 
+    /// @brief Get the time until which a link is busy
+    /// @param src source NPU ID
+    /// @param dest destination NPU ID
+    /// @return time until which the link is busy (negative if the link is free)
+    [[nodiscard]] Time busyUntil(NpuID src, NpuID dest) const noexcept;
+
     /// @brief Mark a chunk as being transferred over a link
     /// @param src source NPU ID
     /// @param dest destination NPU ID
@@ -72,6 +97,13 @@ class TimeExpandedNetwork {
     /// @param time time until which the link is busy
     void transferChunk(NpuID src, NpuID dest, ChunkID chunk, Time time) noexcept;
 
+    /// @brief Keep a link busy until a given time, without any chunk transfer
+    /// @details e.g., with a transfer of an earlier collective; the link frees up by itself.
+    /// @param src source NPU ID
+    /// @param dest destination NPU ID
+    /// @param time time until which the link is busy
+    void occupy(NpuID src, NpuID dest, Time time) noexcept;
+
     /// @brief Mark a chunk transfer as finished over a link
     /// @details This resets the chunk information and link busy time.
     /// @param src source NPU ID
@@ -0,0 +1,58 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <tacos/collective/collective.h>
+#include <tacos/event_queue/event_queue.h>
+#include <tacos/topology/topology.h>
+#include <tacos/writer/synthesis_result.h>
+#include <vector>
+
+namespace tacos {
+
+/// @brief Derive the schedule of a reduction collective by reversing its dual in time.
+/// @details Every transfer src -> dest of the dual (e.g., all-gather) schedule becomes a
+/// transfer dest -> src of the partial chunk, and the transfers of every link keep their
+/// reversed order. An NPU sends a partial chunk once it received and reduced the partial
+/// chunks of all NPUs it forwarded the chunk to in the dual schedule, each reduction taking
+/// the given per-hop reduction time, and not before the chunk is released (see
+/// Collective::releaseTime). The reversed schedule is then re-timed as soon as possible,
+/// and completes once every chunk is reduced at the NPU of its precondition.
+/// If the reduced chunks are gathered back (see Collective::gathered), the dual schedule is
+/// replayed as well, each chunk as soon as it is reduced rather than after all of them.
+/// The gathers fill the gaps each link leaves between its reductions, which thus complete
+/// as early as in the reduction alone.
+class TimeReversal {
+  public:
+    using Time = EventQueue::Time;
+    using NpuID = Topology::NpuID;
+    using ChunkID = Collective::ChunkID;
+    using ChunkSize = Collective::ChunkSize;
+
+    /// @brief Reverse the schedule of the dual collective in time
+    /// @param topology network topology (whose links must be bidirectional)
+    /// @param collective reduction collective
+    /// @param chunkSize size of each chunk (in bytes)
+    /// @param dualResult schedule of the dual collective
+    /// @param reductionTime time to reduce a received partial chunk (in microseconds)
+    /// @param linksBusyUntil time until which each link is busy beforehand (empty: all free)
+    /// @param issueTime issue time of the collective, to which the chunk release times are
+    /// relative (in microseconds)
+    /// @return schedule of the reduction collective
+    [[nodiscard]] static SynthesisResult reverse(
+        const Topology& topology,
+        const Collective& collective,
+        ChunkSize chunkSize,
+        SynthesisResult& dualResult,
+        Time reductionTime,
+        const std::vector<std::vector<Time>>& linksBusyUntil = {},
+        Time issueTime = 0) noexcept;
+};
+
+}  // namespace tacos
@@ -0,0 +1,65 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <tacos/collective/workload.h>
+#include <tacos/event_queue/event_queue.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/topology.h>
+#include <tacos/writer/synthesis_result.h>
+#include <vector>
+
+namespace tacos {
+
+/// @brief Synthesize the collectives of a workload back to back, on the same network.
+/// @details The steps are synthesized in the order of their issue times, each one from its
+/// issue time and with the links still busy with the transfers of the steps synthesized
+/// before, rather than in isolation on idle links. Every link thus serves the steps one after
+/// the other: a step only uses a link once the steps issued before it are done with it, even
+/// if they leave the link idle in between. Overlapping collectives contend for the links they
+/// share, but never fill the idle gaps of each other's schedules.
+class WorkloadSynthesizer {
+  public:
+    using Time = EventQueue::Time;
+    using StepID = Workload::StepID;
+
+    /// @brief Outcome of a workload synthesis
+    struct Result {
+        /// @brief schedule of each step, timed from the start of the iteration
+        /// (its collective time is the completion time)
+        std::vector<SynthesisResult> synthesisResults;
+
+        /// @brief issue time of each step (in microseconds)
+        std::vector<Time> issueTimes;
+
+        /// @brief completion time of each step (in microseconds)
+        std::vector<Time> completionTimes;
+
+        /// @brief end-to-end communication time of the iteration, i.e., the completion time
+        /// of the last step (in microseconds)
+        Time iterationTime;
+    };
+
+    /// @brief Get the synthesizer of the steps, e.g., to set its policies or seed
+    /// @details Its issue time and busy links are set for every step, then reset.
+    /// @return synthesizer of the steps
+    [[nodiscard]] Synthesizer& synthesizer() noexcept;
+
+    /// @brief Synthesize the steps of a workload back to back
+    /// @param topology network topology
+    /// @param workload steps to synthesize
+    /// @return per-step schedules, issue and completion times
+    [[nodiscard]] Result solve(const Topology& topology, const Workload& workload) noexcept;
+
+  private:
+    /// @brief synthesizer of the steps
+    Synthesizer synthesizer_ = {};
+};
+
+}  // namespace tacos
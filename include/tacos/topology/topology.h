@@ -47,7 +47,16 @@ class Topology {
     /// @brief Backtrack a destination NPU to find all NPUs that can send a chunk to it
     /// @param dest destination NPU ID
     /// @return set of source NPU IDs that can send a chunk to the destination NPU
-    [[nodiscard]] std::vector<NpuID> backtrack(NpuID dest) const noexcept;
+    [[nodiscard]] const std::vector<NpuID>& backtrack(NpuID dest) const noexcept;
+
+    /// @brief Compute the hop distance between every pair of NPUs
+    /// @return hops[src][dest] = minimum number of links from src to dest (-1 if unreachable)
+    [[nodiscard]] std::vector<std::vector<int>> hopDistances() const noexcept;
+
+    /// @brief Compute the minimum path latency between every pair of NPUs
+    /// @return latencies[src][dest] = minimum total latency (in microseconds)
+    /// of a path from src to dest (-1 if unreachable)
+    [[nodiscard]] std::vector<std::vector<Latency>> pathLatencies() const noexcept;
 
     /// @brief Get the number of NPUs in the topology
     /// @return number of NPUs
@@ -59,6 +68,12 @@ class Topology {
     /// @return true if a link exists, false otherwise
     [[nodiscard]] bool connected(NpuID src, NpuID dest) const noexcept;
 
+    /// @brief Get the generation of the topology, e.g., to reuse what was derived from it
+    /// @details Every topology gets a new generation whenever its links change, so that two
+    /// topologies share a generation only if one is a copy of the other.
+    /// @return generation of the topology
+    [[nodiscard]] uint64_t generation() const noexcept;
+
   protected:
     /// @brief number of NPUs in the topology
     int npusCount_ = -1;
@@ -91,5 +106,11 @@ class Topology {
 
     /// @brief set of NPUs that can send a chunk to a given NPU
     std::unordered_map<NpuID, std::vector<NpuID>> backtrackMap_ = {};
+
+    /// @brief generation of the topology
+    uint64_t generation_;
+
+    /// @brief Assign a new generation to the topology
+    void nextGeneration_() noexcept;
 };
 }  // namespace tacos
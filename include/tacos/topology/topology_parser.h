@@ -0,0 +1,35 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <tacos/topology/topology.h>
+
+namespace tacos {
+
+/// @brief Construct topologies from compact textual specifications.
+/// @details A specification has the form <kind>:<dims>:<link>[:<link>...], where
+/// dims are separated by 'x' and each link is written as <bandwidth>/<latency>
+/// (in GiB/sec and microseconds), e.g., "mesh2d:4x3:50/0.5" or
+/// "hetero_mesh2d:4x4:100/0.5:50/1". Supported kinds are mesh2d, torus2d,
+/// mesh2d_hetero, hetero_mesh2d (2 dims), torus3d, hypercube3d, and hetero_mesh3d (3 dims).
+/// Heterogeneous kinds take one link per dimension.
+class TopologyParser {
+  public:
+    /// @brief Parse a topology specification and construct the topology.
+    /// @param spec topology specification
+    /// @param maxNpusCount maximum number of NPUs of the topology
+    /// @return constructed topology, or nullptr if the specification is invalid
+    /// or has more than maxNpusCount NPUs
+    [[nodiscard]] static std::unique_ptr<Topology> parse(
+        const std::string& spec, int maxNpusCount = std::numeric_limits<int>::max()) noexcept;
+};
+}  // namespace tacos
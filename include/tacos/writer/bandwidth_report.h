@@ -0,0 +1,96 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <tacos/collective/collective.h>
+#include <tacos/event_queue/event_queue.h>
+#include <vector>
+
+namespace tacos {
+
+/// @brief nccl-tests style bandwidth report of synthesized collective algorithms.
+/// @details For every buffer size, the synthesized collective time is turned into
+/// the algorithm bandwidth (algbw = size / time) and the bus bandwidth
+/// (busbw = algbw * factor), where the factor of each collective follows nccl-tests,
+/// so that synthesized algorithms compare directly against measured NCCL numbers.
+class BandwidthReport {
+  public:
+    using ChunkSize = Collective::ChunkSize;
+    using Time = EventQueue::Time;
+
+    /// @brief Collective types, as reported by nccl-tests
+    enum class CollectiveType { AllGather, ReduceScatter, AllReduce, AllToAll, Broadcast, Reduce };
+
+    /// @brief Construct an empty report
+    /// @param type collective type (determines the bus bandwidth factor)
+    /// @param npusCount number of NPUs taking part in the collective
+    /// @param root root NPU of Broadcast and Reduce (ignored by rootless collectives)
+    BandwidthReport(CollectiveType type, int npusCount, int root = 0) noexcept;
+
+    /// @brief Add a row to the report
+    /// @param size buffer size (in bytes), i.e., the size column of nccl-tests
+    /// @param collectiveTime synthesized collective time (in microseconds)
+    void add(ChunkSize size, Time collectiveTime) noexcept;
+
+    /// @brief Algorithm bandwidth of a row
+    /// @param row row index
+    /// @return algorithm bandwidth (in GB/s)
+    [[nodiscard]] double algorithmBandwidth(int row) const noexcept;
+
+    /// @brief Bus bandwidth of a row
+    /// @param row row index
+    /// @return bus bandwidth (in GB/s)
+    [[nodiscard]] double busBandwidth(int row) const noexcept;
+
+    /// @brief Bus bandwidth factor of a collective, as defined by nccl-tests
+    /// @param type collective type
+    /// @param npusCount number of NPUs taking part in the collective
+    /// @return ratio of the bus bandwidth to the algorithm bandwidth
+    [[nodiscard]] static double busBandwidthFactor(CollectiveType type, int npusCount) noexcept;
+
+    /// @brief Print the report as an nccl-tests table
+    /// @details Synthesized algorithms run in place and are not data-checked,
+    /// so the out-of-place columns repeat the in-place ones and #wrong is N/A.
+    /// @param os output stream
+    void print(std::ostream& os) const noexcept;
+
+    /// @brief Write the report as a CSV file, one row per buffer size
+    /// @param path CSV file path
+    /// @return true if the file was written, false otherwise
+    [[nodiscard]] bool writeCsv(const std::string& path) const noexcept;
+
+  private:
+    /// @brief A row of the report
+    struct Row {
+        /// @brief buffer size (in bytes)
+        ChunkSize size;
+
+        /// @brief synthesized collective time (in microseconds)
+        Time time;
+    };
+
+    /// @brief collective type
+    CollectiveType type_;
+
+    /// @brief number of NPUs taking part in the collective
+    int npusCount_;
+
+    /// @brief nccl-tests root column (-1 for rootless collectives)
+    int root_;
+
+    /// @brief rows of the report, in insertion order
+    std::vector<Row> rows_ = {};
+
+    /// @brief nccl-tests name of the reduction operator column
+    [[nodiscard]] const char* redop_() const noexcept;
+};
+
+}  // namespace tacos
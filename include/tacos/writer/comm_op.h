@@ -9,6 +9,7 @@ Copyright (c) 2022-2025 Georgia Institute of Technology
 #pragma once
 
 #include <tacos/collective/collective.h>
+#include <tacos/event_queue/event_queue.h>
 
 namespace tacos {
 
@@ -17,25 +18,31 @@ class CommOp {
     using ChunkID = Collective::ChunkID;
     using LinkID = int;
     using OpID = int;
+    using Time = EventQueue::Time;
 
-    CommOp(ChunkID chunkId, LinkID linkId, OpID opId) noexcept;
+    CommOp(ChunkID chunkId, LinkID linkId, OpID opId, Time time) noexcept;
 
     void setDepOp(CommOp* depOp);
     void setDepended();
+    void setReduction();
 
     [[nodiscard]] ChunkID chunkId() const noexcept;
     [[nodiscard]] bool hasDep() const noexcept;
     [[nodiscard]] LinkID linkId() const noexcept;
     [[nodiscard]] OpID opId() const noexcept;
+    [[nodiscard]] Time time() const noexcept;
     [[nodiscard]] const CommOp* depOp() const noexcept;
     [[nodiscard]] bool depended() const noexcept;
+    [[nodiscard]] bool reduction() const noexcept;
 
   private:
     ChunkID chunkId_;
     LinkID linkId_;
     OpID opId_;
+    Time time_;
     bool hasDep_ = false;
     bool depended_ = false;
+    bool reduction_ = false;
     CommOp* depOp_;
 };
 
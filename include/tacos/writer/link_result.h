@@ -23,12 +23,13 @@ class LinkResult {
     using ChunkID = Collective::ChunkID;
     using LinkID = CommOp::LinkID;
     using OpID = CommOp::OpID;
+    using Time = CommOp::Time;
 
     LinkResult(LinkID linkId, LinkType type, NpuResult* npu) noexcept;
 
     [[nodiscard]] LinkID id() const noexcept;
-    void send(ChunkID chunk) noexcept;
-    void recv(ChunkID chunk) noexcept;
+    void send(ChunkID chunk, Time time) noexcept;
+    void recv(ChunkID chunk, Time time, bool reduction = false) noexcept;
     [[nodiscard]] const std::map<OpID, CommOp>& ops() const noexcept;
 
   private:
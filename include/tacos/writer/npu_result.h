@@ -10,6 +10,7 @@ Copyright (c) 2022-2025 Georgia Institute of Technology
 
 #include <map>
 #include <memory>
+#include <set>
 #include <tacos/collective/collective.h>
 #include <tacos/topology/topology.h>
 #include <tacos/writer/comm_op.h>
@@ -32,7 +33,7 @@ class NpuResult {
     [[nodiscard]] const std::map<NpuID, LinkResult>& ingressLinks() const noexcept;
     [[nodiscard]] const std::map<NpuID, LinkResult>& egressLinks() const noexcept;
 
-    void registerRecvDep(ChunkID chunk, CommOp* depOp) noexcept;
+    void registerRecvDep(ChunkID chunk, CommOp* depOp, bool reduction = false) noexcept;
     CommOp* getDep(ChunkID chunk) noexcept;
 
   private:
@@ -40,6 +41,7 @@ class NpuResult {
     NpuID id_;
     LinkID nextLinkId_ = 0;
     std::map<ChunkID, CommOp*> depRecvOp_;
+    std::set<ChunkID> partialChunks_;
     std::map<NpuID, LinkResult> ingressLinks_;
     std::map<NpuID, LinkResult> egressLinks_;
 };
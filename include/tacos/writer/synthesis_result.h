@@ -27,6 +27,13 @@ class SynthesisResult {
     void collectiveTime(Time time) noexcept;
     [[nodiscard]] Time collectiveTime() const noexcept;
 
+    /// @brief Check if another result schedules the same chunks over the same links
+    /// @details Two results are equivalent if every link sends the same chunks in the same
+    /// order (and hence with the same dependencies), regardless of the transfer times.
+    /// @param other synthesis result over the same topology and collective
+    /// @return true if both results have the same schedule, false otherwise
+    [[nodiscard]] bool sameSchedule(const SynthesisResult& other) const noexcept;
+
   private:
     int npusCount_;
     std::vector<NpuResult> npus_;
@@ -14,32 +14,147 @@ Copyright (c) 2022-2025 Georgia Institute of Technology
 #include <tacos/collective/collective.h>
 #include <tacos/topology/topology.h>
 #include <tacos/writer/synthesis_result.h>
+#include <unordered_map>
+#include <vector>
 
 namespace tacos {
 
 class XmlWriter {
   public:
     using NpuID = Topology::NpuID;
+    using ChunkID = Collective::ChunkID;
+    using ChunkSize = Collective::ChunkSize;
+    using Time = EventQueue::Time;
+
+    /// @brief How the ops of each link are spread across channels
+    enum class ChannelPolicy {
+        /// @brief the ops of each link are dealt to its channels in round-robin order
+        LinkRoundRobin,
+
+        /// @brief every chunk is split into channelsCount sub-chunks, one per channel
+        ChunkSplit
+    };
 
     XmlWriter(const std::string& filename,
               const Topology& topology,
               const Collective& collective,
               SynthesisResult& synthesisResult) noexcept;
 
+    /// @brief Spread the ops of each link across multiple channels
+    /// @param channelsCount number of channels
+    /// @param policy channel assignment policy
+    void channels(int channelsCount, ChannelPolicy policy = ChannelPolicy::LinkRoundRobin) noexcept;
+
+    /// @brief Fuse the send and recv threadblocks of each peer into bidirectional threadblocks
+    /// @details If maxThreadblocks is positive, the remaining send-only and recv-only
+    /// threadblocks (of different peers) are fused as well, until each GPU
+    /// has at most maxThreadblocks threadblocks (if possible).
+    /// For reduction collectives, the send threadblock of each peer is instead fused with the
+    /// recv threadblock feeding it the most, and a partial chunk received, reduced ("rrc"),
+    /// and then sent on by the same threadblock makes a single step ("rrs").
+    /// @param maxThreadblocks maximum number of threadblocks per GPU (non-positive: no cap)
+    void fuseThreadblocks(int maxThreadblocks = 0) noexcept;
+
+    /// @brief Set the range of buffer sizes this algorithm is selected for
+    /// @param minBytes smallest buffer size (in bytes)
+    /// @param maxBytes largest buffer size (in bytes)
+    void bytes(ChunkSize minBytes, ChunkSize maxBytes) noexcept;
+
+    /// @brief Coalesce contiguous transfers of a link into multi-chunk steps (cnt > 1)
+    /// @details Consecutive ops of a link channel are merged when their chunk IDs are
+    /// contiguous and they wait for the same (coalesced) recv step, if any.
+    /// Not applicable to ChannelPolicy::ChunkSplit, whose sub-chunks are never contiguous,
+    /// nor to reduction collectives, whose recvs wait for the previous recv of their chunk.
+    void coalesceSteps() noexcept;
+
     void write() noexcept;
 
   private:
+    /// @brief A step of a threadblock
+    struct Step {
+        /// @brief step type (e.g., "s" for send, "r" for recv)
+        std::string type;
+
+        /// @brief buffer offset (in chunks)
+        int offset;
+
+        /// @brief number of contiguous chunks
+        int count;
+
+        /// @brief threadblock index of the dependency (-1 if none)
+        int depTb;
+
+        /// @brief step index of the dependency (-1 if none)
+        int depStep;
+
+        /// @brief true if other steps depend on this step
+        bool depended;
+
+        /// @brief position of the step in the global execution order (see groupOps)
+        int order;
+    };
+
+    /// @brief A run of ops of a link channel written as a single step
+    struct OpGroup {
+        /// @brief first send op of the group
+        const CommOp* first;
+
+        /// @brief last send op of the group
+        const CommOp* last;
+
+        /// @brief group the sends of this group wait for (-1 if none)
+        int depGroup;
+
+        /// @brief true once a send depends on this group, which then cannot grow
+        bool sealed;
+
+        /// @brief position of the group in the global execution order
+        int order;
+    };
+
+    /// @brief A threadblock of a GPU
+    struct Threadblock {
+        /// @brief peer NPU this threadblock sends to (-1 if none)
+        NpuID send;
+
+        /// @brief peer NPU this threadblock receives from (-1 if none)
+        NpuID recv;
+
+        /// @brief channel of this threadblock
+        int channel;
+
+        /// @brief steps of this threadblock
+        std::vector<Step> steps;
+    };
+
     pugi::xml_document xml;
     pugi::xml_node algo;
     std::string path;
     const Topology& topology_;
     const Collective& collective_;
     SynthesisResult& synthesisResult_;
+    int channelsCount_ = 1;
+    ChannelPolicy channelPolicy_ = ChannelPolicy::LinkRoundRobin;
+    bool fuseThreadblocks_ = false;
+    int maxThreadblocks_ = 0;
+    bool coalesceSteps_ = false;
+    ChunkSize minBytes_ = 0;
+    ChunkSize maxBytes_ = 0;
+    std::unordered_map<const CommOp*, const CommOp*> matchingSend_;
+    std::unordered_map<const CommOp*, int> groups_;
+    std::vector<OpGroup> opGroups_;
 
     void writeAlgo() noexcept;
     void writeNpu(NpuID npuId) noexcept;
-    void writeIngressLink(pugi::xml_node& gpu, NpuID npu, NpuID src, const LinkResult& link) noexcept;
-    void writeEgressLink(pugi::xml_node& gpu, NpuID npu, NpuID dest, const LinkResult& link) noexcept;
+    void groupOps() noexcept;
+    [[nodiscard]] int group(const CommOp& op) const noexcept;
+    [[nodiscard]] std::vector<Threadblock> assignChannels(NpuID npuId) const noexcept;
+    [[nodiscard]] std::vector<Threadblock> fuseThreadblocks(
+        NpuID npuId, const std::vector<Threadblock>& threadblocks) const noexcept;
+    [[nodiscard]] std::vector<Threadblock> fuseReductions(
+        const std::vector<Threadblock>& threadblocks) const noexcept;
+    void writeThreadblock(pugi::xml_node& gpu, int id, const Threadblock& threadblock) noexcept;
+    [[nodiscard]] int chunksPerLoop() const noexcept;
     void save() noexcept;
 };
 
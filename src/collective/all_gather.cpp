@@ -14,6 +14,7 @@ using namespace tacos;
 AllGather::AllGather(const int npusCount, const int collectivesCount) noexcept : Collective() {
     assert(collectivesCount > 0);
 
+    name_ = "allgather";
     auto chunkId = 0;
 
     // destination for All-Gather: all NPUs in the topology
@@ -0,0 +1,33 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cassert>
+#include <tacos/collective/all_reduce.h>
+
+using namespace tacos;
+
+AllReduce::AllReduce(const int npusCount, const int collectivesCount) noexcept : Collective() {
+    assert(collectivesCount > 0);
+
+    name_ = "allreduce";
+    reduction_ = true;
+    gathered_ = true;
+
+    // contributors (and destinations) for All-Reduce: all NPUs in the topology
+    auto contributors = std::unordered_set<NpuID>();
+    for (auto npu = 0; npu < npusCount; ++npu) {
+        contributors.insert(npu);
+    }
+
+    // register chunks for all owner NPUs
+    for (int c = 0; c < collectivesCount; ++c) {
+        for (int owner = 0; owner < npusCount; ++owner) {
+            chunk_(owner, contributors);
+        }
+    }
+}
@@ -0,0 +1,48 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cassert>
+#include <tacos/collective/all_to_all.h>
+
+using namespace tacos;
+
+AllToAll::AllToAll(const int npusCount, const int collectivesCount) noexcept : Collective() {
+    assert(npusCount > 1);
+    assert(collectivesCount > 0);
+
+    name_ = "alltoall";
+
+    // register a chunk for every (src, dest) pair
+    for (int c = 0; c < collectivesCount; ++c) {
+        for (int src = 0; src < npusCount; ++src) {
+            for (int dest = 0; dest < npusCount; ++dest) {
+                if (src != dest) {
+                    chunk_(src, {dest});
+                }
+            }
+        }
+    }
+}
+
+AllToAllv::AllToAllv(const std::vector<std::vector<ChunkSize>>& sizes) noexcept : Collective() {
+    const auto npusCount = static_cast<int>(sizes.size());
+    assert(npusCount > 1);
+
+    name_ = "alltoallv";
+
+    // register a chunk of its own size for every (src, dest) pair exchanging data
+    for (int src = 0; src < npusCount; ++src) {
+        assert(static_cast<int>(sizes[src].size()) == npusCount);
+        for (int dest = 0; dest < npusCount; ++dest) {
+            assert(sizes[src][dest] >= 0);
+            if (src != dest && sizes[src][dest] > 0) {
+                chunk_(src, {dest}, sizes[src][dest]);
+            }
+        }
+    }
+}
@@ -0,0 +1,56 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cassert>
+#include <tacos/collective/broadcast.h>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief All NPUs of the topology
+/// @param npusCount number of NPUs in the topology
+/// @return set of all NPU IDs
+std::unordered_set<Collective::NpuID> allNpus(const int npusCount) noexcept {
+    auto npus = std::unordered_set<Collective::NpuID>();
+    for (auto npu = 0; npu < npusCount; ++npu) {
+        npus.insert(npu);
+    }
+    return npus;
+}
+
+}  // namespace
+
+Broadcast::Broadcast(const int npusCount, const int chunksCount, const NpuID root) noexcept
+    : Collective() {
+    assert(chunksCount > 0);
+    assert(0 <= root && root < npusCount);
+
+    name_ = "broadcast";
+
+    // register all chunks at the root, destined to all NPUs
+    const auto dests = allNpus(npusCount);
+    for (int c = 0; c < chunksCount; ++c) {
+        chunk_(root, dests);
+    }
+}
+
+Reduce::Reduce(const int npusCount, const int chunksCount, const NpuID root) noexcept
+    : Collective() {
+    assert(chunksCount > 0);
+    assert(0 <= root && root < npusCount);
+
+    name_ = "reduce";
+    reduction_ = true;
+
+    // register all chunks at the root, reduced from all NPUs
+    const auto contributors = allNpus(npusCount);
+    for (int c = 0; c < chunksCount; ++c) {
+        chunk_(root, contributors);
+    }
+}
@@ -6,7 +6,9 @@ Copyright (c) 2022-2025 Intel Corporation
 Copyright (c) 2022-2025 Georgia Institute of Technology
 *******************************************************************************/
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 #include <tacos/collective/collective.h>
 
 using namespace tacos;
@@ -18,34 +20,165 @@ int Collective::chunksCount() const noexcept {
     return chunksCount_;
 }
 
-void Collective::chunk_(const NpuID src, std::unordered_set<NpuID> dests) noexcept {
+const std::string& Collective::name() const noexcept {
+    return name_;
+}
+
+Collective::ChunkSize Collective::size(const ChunkID chunk) const noexcept {
+    assert(0 <= chunk && chunk < chunksCount_);
+
+    return sizes_.empty() ? 0 : sizes_[chunk];
+}
+
+bool Collective::sized() const noexcept {
+    return !sizes_.empty();
+}
+
+Collective::Time Collective::releaseTime(const ChunkID chunk) const noexcept {
+    assert(0 <= chunk && chunk < chunksCount_);
+
+    return chunk < static_cast<int>(releaseTimes_.size()) ? releaseTimes_[chunk] : 0;
+}
+
+void Collective::releaseTime(const ChunkID chunk, const Time time) noexcept {
+    assert(0 <= chunk && chunk < chunksCount_);
+    assert(time >= 0);
+
+    if (chunk >= static_cast<int>(releaseTimes_.size())) {
+        releaseTimes_.resize(chunksCount_, 0);
+    }
+    releaseTimes_[chunk] = time;
+}
+
+Collective::Time Collective::deadline(const ChunkID chunk) const noexcept {
+    assert(0 <= chunk && chunk < chunksCount_);
+
+    return chunk < static_cast<int>(deadlines_.size()) ? deadlines_[chunk]
+                                                        : std::numeric_limits<Time>::infinity();
+}
+
+void Collective::deadline(const ChunkID chunk, const Time time) noexcept {
+    assert(0 <= chunk && chunk < chunksCount_);
+    assert(time >= 0);
+
+    if (chunk >= static_cast<int>(deadlines_.size())) {
+        deadlines_.resize(chunksCount_, std::numeric_limits<Time>::infinity());
+    }
+    deadlines_[chunk] = time;
+}
+
+bool Collective::staggered() const noexcept {
+    return std::any_of(releaseTimes_.begin(), releaseTimes_.end(),
+                       [](const Time time) { return time > 0; });
+}
+
+bool Collective::prioritized() const noexcept {
+    return !deadlines_.empty();
+}
+
+bool Collective::reduction() const noexcept {
+    return reduction_;
+}
+
+bool Collective::gathered() const noexcept {
+    return gathered_;
+}
+
+void Collective::chunk_(const NpuID src,
+                        std::unordered_set<NpuID> dests,
+                        const ChunkSize size) noexcept {
     assert(src >= 0);
     assert(!dests.empty());
+    assert(size >= 0);
+
+    // share the destinations of the last chunk if they are the same
+    auto destinations = static_cast<int>(destinationSets_.size()) - 1;
+    if (destinations < 0 || destinationSets_[destinations] != dests) {
+        destinations = destinations_(std::move(dests));
+    }
+    sharedChunk_(src, destinations, size);
+}
+
+int Collective::destinations_(std::unordered_set<NpuID> dests) noexcept {
+    assert(!dests.empty());
+
+    destinationSets_.push_back(std::move(dests));
+    return static_cast<int>(destinationSets_.size()) - 1;
+}
+
+void Collective::sharedChunk_(const NpuID src,
+                              const int destinations,
+                              const ChunkSize size) noexcept {
+    assert(src >= 0);
+    assert(0 <= destinations && destinations < static_cast<int>(destinationSets_.size()));
+    assert(size >= 0);
 
     // assert this chunk is not already registered
-    assert(precondition_.find(newChunkID_) == precondition_.end());
-    assert(postcondition_.find(newChunkID_) == postcondition_.end());
+    assert(static_cast<int>(precondition_.size()) == newChunkID_);
 
     // insert to precondition and postcondition
-    precondition_[newChunkID_] = src;
-    postcondition_[newChunkID_] = std::move(dests);
+    precondition_.push_back(src);
+    postcondition_.push_back(destinations);
     chunksCount_++;
 
+    // replicas are only stored once some chunk has replicas
+    if (!replicas_.empty()) {
+        replicas_.emplace_back();
+    }
+
+    // sizes are only stored once some chunk has a size of its own
+    if (size > 0 || !sizes_.empty()) {
+        sizes_.resize(newChunkID_, 0);
+        sizes_.push_back(size);
+    }
+
     // increment nw chunkID for the next chunk
     newChunkID_++;
 }
 
 Collective::NpuID Collective::precondition(const ChunkID chunk) const noexcept {
     assert(0 <= chunk && chunk < chunksCount_);
-    assert(precondition_.find(chunk) != precondition_.end());
 
-    return precondition_.at(chunk);
+    return precondition_[chunk];
 }
 
 const std::unordered_set<Collective::NpuID>& Collective::postcondition(
     ChunkID chunk) const noexcept {
     assert(0 <= chunk && chunk < chunksCount_);
-    assert(postcondition_.find(chunk) != postcondition_.end());
 
-    return postcondition_.at(chunk);
+    return destinationSets_[postcondition_[chunk]];
+}
+
+const std::vector<Collective::NpuID>& Collective::replicas(const ChunkID chunk) const noexcept {
+    assert(0 <= chunk && chunk < chunksCount_);
+
+    static const auto none = std::vector<NpuID>();
+    return replicas_.empty() ? none : replicas_[chunk];
+}
+
+bool Collective::replicated() const noexcept {
+    return !replicas_.empty();
+}
+
+void Collective::replicate_(const ChunkID chunk, const NpuID npu) noexcept {
+    assert(0 <= chunk && chunk < chunksCount_);
+    assert(npu >= 0);
+    assert(!reduction_);
+
+    // a chunk is held at most once by every NPU
+    if (npu == precondition_[chunk]) {
+        return;
+    }
+    replicas_.resize(chunksCount_);
+    auto& replicas = replicas_[chunk];
+    if (std::find(replicas.begin(), replicas.end(), npu) == replicas.end()) {
+        replicas.push_back(npu);
+    }
+}
+
+void Collective::reserveChunks_(const int chunksCount) noexcept {
+    assert(chunksCount >= 0);
+
+    precondition_.reserve(chunksCount);
+    postcondition_.reserve(chunksCount);
 }
@@ -0,0 +1,60 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cassert>
+#include <sstream>
+#include <tacos/collective/all_gather.h>
+#include <tacos/collective/all_reduce.h>
+#include <tacos/collective/all_to_all.h>
+#include <tacos/collective/broadcast.h>
+#include <tacos/collective/collective_parser.h>
+#include <tacos/collective/reduce_scatter.h>
+
+using namespace tacos;
+
+std::unique_ptr<Collective> CollectiveParser::parse(const std::string& spec,
+                                                    const int npusCount,
+                                                    const int maxCollectivesCount) noexcept {
+    assert(npusCount > 0);
+
+    // split kind and the (optional) number of chunks per NPU
+    const auto delimiter = spec.find(':');
+    const auto kind = spec.substr(0, delimiter);
+    auto collectivesCount = 1;
+    if (delimiter != std::string::npos) {
+        auto stream = std::istringstream(spec.substr(delimiter + 1));
+        stream >> collectivesCount;
+        if (stream.fail() || !stream.eof() || collectivesCount <= 0 ||
+            collectivesCount > maxCollectivesCount) {
+            return nullptr;
+        }
+    }
+
+    // construct the collective
+    if (kind == "allgather") {
+        return std::make_unique<AllGather>(npusCount, collectivesCount);
+    }
+    if (kind == "reducescatter") {
+        return std::make_unique<ReduceScatter>(npusCount, collectivesCount);
+    }
+    if (kind == "allreduce") {
+        return std::make_unique<AllReduce>(npusCount, collectivesCount);
+    }
+    if (kind == "broadcast") {
+        return std::make_unique<Broadcast>(npusCount, collectivesCount);
+    }
+    if (kind == "reduce") {
+        return std::make_unique<Reduce>(npusCount, collectivesCount);
+    }
+    if (kind == "alltoall" && npusCount > 1) {
+        return std::make_unique<AllToAll>(npusCount, collectivesCount);
+    }
+
+    // unknown collective kind
+    return nullptr;
+}
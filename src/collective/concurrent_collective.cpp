@@ -0,0 +1,130 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <tacos/collective/concurrent_collective.h>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief Collective mapped onto a group of NPUs of the topology
+class MappedCollective final : public Collective {
+  public:
+    /// @brief Map a collective onto a group of NPUs
+    /// @param collective collective over npus.size() NPUs
+    /// @param npus NPU of the topology standing for each NPU of the collective
+    MappedCollective(const Collective& collective, const std::vector<NpuID>& npus) noexcept
+        : Collective() {
+        name_ = collective.name();
+        reduction_ = collective.reduction();
+        gathered_ = collective.gathered();
+
+        const auto chunksCount = collective.chunksCount();
+        reserveChunks_(chunksCount);
+        for (auto chunk = 0; chunk < chunksCount; chunk++) {
+            const auto& dests = collective.postcondition(chunk);
+            auto mappedDests = std::unordered_set<NpuID>();
+            for (const auto dest : dests) {
+                assert(dest < static_cast<int>(npus.size()));
+                mappedDests.insert(npus[dest]);
+            }
+            chunk_(npus[collective.precondition(chunk)], std::move(mappedDests),
+                   collective.size(chunk));
+            for (const auto replica : collective.replicas(chunk)) {
+                replicate_(chunk, npus[replica]);
+            }
+            if (collective.releaseTime(chunk) > 0) {
+                releaseTime(chunk, collective.releaseTime(chunk));
+            }
+            if (collective.prioritized()) {
+                deadline(chunk, collective.deadline(chunk));
+            }
+        }
+    }
+};
+
+}  // namespace
+
+ConcurrentCollective::ConcurrentCollective() noexcept : Collective() {
+    name_ = "concurrent";
+}
+
+int ConcurrentCollective::add(const Collective& collective,
+                              const std::vector<NpuID>& npus) noexcept {
+    assert(!npus.empty());
+    assert(collective.chunksCount() > 0);
+
+    // every NPU of the collective stands for an NPU of the group
+    [[maybe_unused]] const auto inGroup = [&npus](const NpuID npu) {
+        return 0 <= npu && npu < static_cast<int>(npus.size());
+    };
+    for (auto chunk = 0; chunk < collective.chunksCount(); chunk++) {
+        assert(inGroup(collective.precondition(chunk)));
+        assert(std::all_of(collective.replicas(chunk).begin(), collective.replicas(chunk).end(),
+                           inGroup));
+        assert(std::all_of(collective.postcondition(chunk).begin(),
+                           collective.postcondition(chunk).end(), inGroup));
+    }
+
+    // all groups reduce their chunks alike, or none does
+    if (members_.empty()) {
+        reduction_ = collective.reduction();
+        gathered_ = collective.gathered();
+    }
+    assert(reduction_ == collective.reduction());
+    assert(gathered_ == collective.gathered());
+
+    const auto group = static_cast<int>(members_.size());
+    auto member = std::make_unique<MappedCollective>(collective, npus);
+    firstChunks_.push_back(chunksCount_);
+
+    // append the chunks of the group
+    const auto chunksCount = member->chunksCount();
+    reserveChunks_(chunksCount_ + chunksCount);
+    groups_.resize(chunksCount_ + chunksCount, group);
+    for (auto chunk = 0; chunk < chunksCount; chunk++) {
+        const auto newChunk = chunksCount_;
+        chunk_(member->precondition(chunk), member->postcondition(chunk), member->size(chunk));
+        for (const auto replica : member->replicas(chunk)) {
+            replicate_(newChunk, replica);
+        }
+        if (member->releaseTime(chunk) > 0) {
+            releaseTime(newChunk, member->releaseTime(chunk));
+        }
+        if (member->prioritized()) {
+            deadline(newChunk, member->deadline(chunk));
+        }
+    }
+
+    members_.push_back(std::move(member));
+    return group;
+}
+
+int ConcurrentCollective::groupsCount() const noexcept {
+    return static_cast<int>(members_.size());
+}
+
+int ConcurrentCollective::group(const ChunkID chunk) const noexcept {
+    assert(0 <= chunk && chunk < chunksCount_);
+
+    return groups_[chunk];
+}
+
+ConcurrentCollective::ChunkID ConcurrentCollective::firstChunk(const int group) const noexcept {
+    assert(0 <= group && group < groupsCount());
+
+    return firstChunks_[group];
+}
+
+const Collective& ConcurrentCollective::member(const int group) const noexcept {
+    assert(0 <= group && group < groupsCount());
+
+    return *members_[group];
+}
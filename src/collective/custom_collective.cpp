@@ -0,0 +1,338 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <tacos/collective/custom_collective.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief magic of the binary format
+constexpr char binaryMagic[] = "TACOSCOL";
+
+/// @brief length of the magic of the binary format
+constexpr auto binaryMagicLength = sizeof(binaryMagic) - 1;
+
+/// @brief number of binary chunk records read at once
+constexpr auto recordsPerBlock = 1 << 16;
+
+/// @brief Parse a non-negative integer at the start of a string
+/// @param begin start of the string, advanced past the integer
+/// @param value parsed integer
+/// @return true if an integer has been parsed, false otherwise
+bool parseInteger(const char*& begin, int64_t& value) noexcept {
+    if (*begin < '0' || *begin > '9') {
+        return false;
+    }
+    char* end = nullptr;
+    errno = 0;
+    value = std::strtoll(begin, &end, 10);
+    begin = end;
+    return errno == 0;
+}
+
+/// @brief Parse a destination specification: "*", or comma-separated NPU IDs and ranges
+/// @param spec destination specification
+/// @param npusCount number of NPUs in the topology
+/// @param dests parsed destination NPUs
+/// @return true if the specification is valid, false otherwise
+bool parseDestinations(const std::string& spec,
+                       const int npusCount,
+                       std::unordered_set<Collective::NpuID>& dests) noexcept {
+    dests.clear();
+    if (spec == "*") {
+        for (auto npu = 0; npu < npusCount; npu++) {
+            dests.insert(npu);
+        }
+        return true;
+    }
+
+    const auto* it = spec.c_str();
+    while (true) {
+        auto first = int64_t();
+        if (!parseInteger(it, first)) {
+            return false;
+        }
+        auto last = first;
+        if (*it == '-') {
+            it++;
+            if (!parseInteger(it, last)) {
+                return false;
+            }
+        }
+        if (first > last || last >= npusCount) {
+            return false;
+        }
+        for (auto npu = first; npu <= last; npu++) {
+            dests.insert(static_cast<Collective::NpuID>(npu));
+        }
+        if (*it == '\0') {
+            return true;
+        }
+        if (*it++ != ',') {
+            return false;
+        }
+    }
+}
+
+/// @brief Decode a little-endian unsigned integer
+/// @param bytes encoded integer
+/// @param length number of bytes
+/// @return decoded integer
+uint64_t decode(const unsigned char* const bytes, const int length) noexcept {
+    auto value = uint64_t(0);
+    for (auto i = length - 1; i >= 0; i--) {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+}  // namespace
+
+CustomCollective::CustomCollective() noexcept : Collective() {}
+
+std::unique_ptr<CustomCollective> CustomCollective::load(const std::string& path,
+                                                         const Topology& topology) noexcept {
+    auto input = std::ifstream(path, std::ios::binary);
+    if (!input) {
+        return nullptr;
+    }
+    return read(input, topology);
+}
+
+std::unique_ptr<CustomCollective> CustomCollective::read(std::istream& input,
+                                                         const Topology& topology) noexcept {
+    // tell the binary format by its magic
+    auto magic = std::string(binaryMagicLength, '\0');
+    input.read(magic.data(), binaryMagicLength);
+    const auto binary = (input.gcount() == binaryMagicLength && magic == binaryMagic);
+    if (!binary) {
+        input.clear();
+        input.seekg(0);
+    }
+
+    auto collective = std::unique_ptr<CustomCollective>(new CustomCollective());
+    const auto npusCount = topology.npusCount();
+    const auto valid = binary ? collective->readBinary_(input, npusCount)
+                              : collective->readText_(input, npusCount);
+
+    // a collective has at least one chunk
+    if (!valid || collective->chunksCount_ == 0) {
+        return nullptr;
+    }
+    return collective;
+}
+
+bool CustomCollective::readText_(std::istream& input, const int npusCount) noexcept {
+    auto line = std::string();
+    auto src = std::string();
+    auto destsSpec = std::string();
+    auto dests = std::unordered_set<NpuID>();
+    auto replicas = std::unordered_set<NpuID>();
+
+    // destinations registered for each distinct specification, and the last one used
+    auto registered = std::unordered_map<std::string, int>();
+    auto lastDestsSpec = std::string();
+    auto lastDestinations = -1;
+
+    while (std::getline(input, line)) {
+        // skip leading whitespace, empty lines and comments
+        const auto start = line.find_first_not_of(" \t\r");
+        if (start == std::string::npos || line[start] == '#') {
+            continue;
+        }
+
+        // name directive
+        if (line.compare(start, 5, "name ") == 0) {
+            const auto nameStart = line.find_first_not_of(" \t", start + 5);
+            const auto nameEnd = line.find_last_not_of(" \t\r");
+            if (nameStart == std::string::npos) {
+                return false;
+            }
+            name_ = line.substr(nameStart, nameEnd - nameStart + 1);
+            continue;
+        }
+
+        // <src>[,<replicas>] <dests> [<size>]
+        const auto* it = line.c_str() + start;
+        auto srcValue = int64_t();
+        if (!parseInteger(it, srcValue) || srcValue >= npusCount) {
+            return false;
+        }
+        replicas.clear();
+        if (*it == ',') {
+            const auto* const replicasEnd = it + std::strcspn(it, " \t\r");
+            const auto replicasSpec = std::string(it + 1, replicasEnd);
+            if (!parseDestinations(replicasSpec, npusCount, replicas)) {
+                return false;
+            }
+            it = replicasEnd;
+        }
+        if (*it != ' ' && *it != '\t') {
+            return false;
+        }
+        while (*it == ' ' || *it == '\t') {
+            it++;
+        }
+        const auto* const destsEnd = it + std::strcspn(it, " \t\r");
+        destsSpec.assign(it, destsEnd);
+        it = destsEnd;
+        while (*it == ' ' || *it == '\t') {
+            it++;
+        }
+        auto size = int64_t(0);
+        if (*it != '\0' && *it != '\r' && !parseInteger(it, size)) {
+            return false;
+        }
+        while (*it == ' ' || *it == '\t' || *it == '\r') {
+            it++;
+        }
+        if (*it != '\0') {
+            return false;
+        }
+
+        // chunks with the same destinations share them, parsed once
+        if (lastDestinations < 0 || destsSpec != lastDestsSpec) {
+            const auto it = registered.find(destsSpec);
+            if (it != registered.end()) {
+                lastDestinations = it->second;
+            } else {
+                if (!parseDestinations(destsSpec, npusCount, dests) || dests.empty()) {
+                    return false;
+                }
+                lastDestinations = destinations_(std::move(dests));
+                registered.emplace(destsSpec, lastDestinations);
+            }
+            std::swap(lastDestsSpec, destsSpec);
+        }
+        sharedChunk_(static_cast<NpuID>(srcValue), lastDestinations, size);
+        for (const auto replica : replicas) {
+            replicate_(chunksCount_ - 1, replica);
+        }
+    }
+    return input.eof();
+}
+
+bool CustomCollective::readBinary_(std::istream& input, const int npusCount) noexcept {
+    // header: version, npusCount, chunksCount, flags
+    unsigned char header[20];
+    input.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (input.gcount() != sizeof(header)) {
+        return false;
+    }
+    const auto version = decode(header, 4);
+    const auto fileNpusCount = decode(header + 4, 4);
+    const auto chunksCount = decode(header + 8, 8);
+    const auto flags = decode(header + 16, 4);
+    if (version != 1 || fileNpusCount != static_cast<uint64_t>(npusCount) ||
+        chunksCount > static_cast<uint64_t>(INT32_MAX) || (flags & ~uint64_t(3)) != 0) {
+        return false;
+    }
+    const auto sized = (flags & 1) != 0;
+    const auto replicated = (flags & 2) != 0;
+
+    // record: src, size (if flagged), destination bitmap, replica bitmap (if flagged)
+    const auto bitmapLength = (npusCount + 7) / 8;
+    const auto sizeOffset = 4;
+    const auto bitmapOffset = sized ? 12 : 4;
+    const auto replicasOffset = bitmapOffset + bitmapLength;
+    const auto recordLength = replicasOffset + (replicated ? bitmapLength : 0);
+
+    // a seekable input must hold all the records announced by the header, so that a truncated
+    // or malformed file is rejected before allocating for them; otherwise, the chunks are only
+    // reserved for the first block and grow as the records arrive
+    auto reserved = std::min<uint64_t>(chunksCount, recordsPerBlock);
+    const auto start = input.tellg();
+    if (start != std::streampos(-1) && input.seekg(0, std::ios::end)) {
+        const auto available = static_cast<uint64_t>(input.tellg() - start);
+        if (!input.seekg(start) || available < chunksCount * recordLength) {
+            return false;
+        }
+        reserved = chunksCount;
+    } else {
+        input.clear();
+    }
+    reserveChunks_(static_cast<int>(reserved));
+    auto block = std::vector<unsigned char>();
+    auto dests = std::unordered_set<NpuID>();
+
+    // destinations registered for each distinct bitmap, and the last one used
+    auto registered = std::unordered_map<std::string, int>();
+    auto lastBitmap = std::string(bitmapLength, '\0');
+    auto lastDestinations = -1;
+
+    for (auto remaining = chunksCount; remaining > 0;) {
+        const auto records = std::min<uint64_t>(remaining, recordsPerBlock);
+        block.resize(records * recordLength);
+        input.read(reinterpret_cast<char*>(block.data()), block.size());
+        if (static_cast<uint64_t>(input.gcount()) != block.size()) {
+            return false;
+        }
+        remaining -= records;
+
+        for (auto r = uint64_t(0); r < records; r++) {
+            const auto* const record = block.data() + r * recordLength;
+            const auto src = static_cast<int32_t>(decode(record, 4));
+            const auto size = sized ? static_cast<int64_t>(decode(record + sizeOffset, 8)) : 0;
+            const auto* const bitmap = record + bitmapOffset;
+            if (src < 0 || src >= npusCount || size < 0) {
+                return false;
+            }
+
+            // chunks with the same destinations share them, decoded once
+            if (lastDestinations < 0 || std::memcmp(bitmap, lastBitmap.data(), bitmapLength) != 0) {
+                lastBitmap.assign(reinterpret_cast<const char*>(bitmap), bitmapLength);
+                const auto it = registered.find(lastBitmap);
+                if (it != registered.end()) {
+                    lastDestinations = it->second;
+                } else {
+                    dests.clear();
+                    for (auto npu = 0; npu < bitmapLength * 8; npu++) {
+                        if ((bitmap[npu / 8] >> (npu % 8)) & 1) {
+                            if (npu >= npusCount) {
+                                return false;
+                            }
+                            dests.insert(npu);
+                        }
+                    }
+                    if (dests.empty()) {
+                        return false;
+                    }
+                    lastDestinations = destinations_(std::move(dests));
+                    registered.emplace(lastBitmap, lastDestinations);
+                }
+            }
+            sharedChunk_(src, lastDestinations, size);
+
+            if (replicated) {
+                const auto* const replicas = record + replicasOffset;
+                for (auto npu = 0; npu < bitmapLength * 8; npu++) {
+                    if ((replicas[npu / 8] >> (npu % 8)) & 1) {
+                        if (npu >= npusCount) {
+                            return false;
+                        }
+                        replicate_(chunksCount_ - 1, npu);
+                    }
+                }
+            }
+        }
+    }
+
+    // nothing may follow the chunk records
+    return input.peek() == std::char_traits<char>::eof();
+}
@@ -0,0 +1,60 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cassert>
+#include <tacos/collective/workload.h>
+#include <utility>
+
+using namespace tacos;
+
+Workload::Workload() noexcept = default;
+
+Workload::StepID Workload::add(std::shared_ptr<const Collective> collective,
+                               const ChunkSize chunkSize,
+                               const std::vector<StepID>& dependencies,
+                               const Time computeTime) noexcept {
+    assert(collective != nullptr && collective->chunksCount() > 0);
+    assert(chunkSize > 0);
+    assert(computeTime >= 0);
+
+    const auto step = stepsCount();
+    for (const auto dependency : dependencies) {
+        // the steps are added in a topological order
+        assert(0 <= dependency && dependency < step);
+    }
+
+    collectives_.push_back(std::move(collective));
+    chunkSizes_.push_back(chunkSize);
+    dependencies_.push_back(dependencies);
+    computeTimes_.push_back(computeTime);
+    return step;
+}
+
+int Workload::stepsCount() const noexcept {
+    return static_cast<int>(collectives_.size());
+}
+
+const Collective& Workload::collective(const StepID step) const noexcept {
+    assert(0 <= step && step < stepsCount());
+    return *collectives_[step];
+}
+
+Workload::ChunkSize Workload::chunkSize(const StepID step) const noexcept {
+    assert(0 <= step && step < stepsCount());
+    return chunkSizes_[step];
+}
+
+const std::vector<Workload::StepID>& Workload::dependencies(const StepID step) const noexcept {
+    assert(0 <= step && step < stepsCount());
+    return dependencies_[step];
+}
+
+Workload::Time Workload::computeTime(const StepID step) const noexcept {
+    assert(0 <= step && step < stepsCount());
+    return computeTimes_[step];
+}
@@ -7,6 +7,7 @@ Copyright (c) 2022-2025 Georgia Institute of Technology
 *******************************************************************************/
 
 #include <cassert>
+#include <cmath>
 #include <tacos/event_queue/event_queue.h>
 
 using namespace tacos;
@@ -44,6 +45,12 @@ EventQueue::Time EventQueue::pop() noexcept {
     return time;
 }
 
+EventQueue::Time EventQueue::peek() const noexcept {
+    assert(!events_.empty());
+
+    return event_queue_.top();
+}
+
 bool EventQueue::empty() noexcept {
     return events_.empty();
 }
@@ -56,3 +63,8 @@ void EventQueue::reset() noexcept {
     // schedule the initial event at time 0
     schedule(0);
 }
+
+bool tacos::isEqual(const EventQueue::Time lhs, const EventQueue::Time rhs) noexcept {
+    constexpr EventQueue::Time epsilon = 1e-9;
+    return std::abs(lhs - rhs) < epsilon;
+}
@@ -11,6 +11,7 @@ Copyright (c) 2022-2025 Georgia Institute of Technology
 #include <tacos/event_queue/timer.h>
 #include <tacos/synthesizer/synthesizer.h>
 #include <tacos/topology/mesh_2d.h>
+#include <tacos/writer/bandwidth_report.h>
 
 using namespace tacos;
 
@@ -55,6 +56,18 @@ int main() {
     std::cout << "Time to solve: " << time / 1000 << " ms" << std::endl;
     std::cout << "Collective Time: " << collectiveTime << " us" << std::endl;
 
+    // report the bandwidth over a sweep of output buffer sizes (1 MiB to 64 MiB)
+    auto report = BandwidthReport(BandwidthReport::CollectiveType::AllGather, npusCount);
+    for (auto bufferSize = Collective::ChunkSize(1 << 20); bufferSize <= (1 << 26);
+         bufferSize *= 2) {
+        const auto sweepChunkSize = bufferSize / chunksCount;
+        const auto sweepTime =
+            synthesizer.solve(topology, collective, sweepChunkSize).collectiveTime();
+        report.add(sweepChunkSize * chunksCount, sweepTime);
+    }
+    std::cout << std::endl;
+    report.print(std::cout);
+
     // terminate
     return 0;
 }
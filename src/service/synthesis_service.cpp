@@ -0,0 +1,158 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <tacos/collective/collective_parser.h>
+#include <tacos/event_queue/timer.h>
+#include <tacos/service/synthesis_service.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/topology_parser.h>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief Check whether a collective has any chunk to transfer.
+bool transfers(const Collective& collective) noexcept {
+    for (auto chunk = 0; chunk < collective.chunksCount(); chunk++) {
+        const auto& replicas = collective.replicas(chunk);
+        for (const auto dest : collective.postcondition(chunk)) {
+            if (dest != collective.precondition(chunk) &&
+                std::find(replicas.begin(), replicas.end(), dest) == replicas.end()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+std::string SynthesisService::Request::key() const noexcept {
+    auto stream = std::ostringstream();
+    stream << topology << ' ' << collective << ' ' << chunkSize << ' ' << budget;
+    return stream.str();
+}
+
+SynthesisService::SynthesisService(const int threadsCount, const int cacheCapacity) noexcept
+    : cacheCapacity_(cacheCapacity), threadPool_(threadsCount) {
+    assert(cacheCapacity > 0);
+}
+
+std::shared_future<SynthesisService::Response> SynthesisService::submit(
+    const Request& request, bool* const cached) noexcept {
+    const auto key = request.key();
+
+    const auto lock = std::lock_guard(mutex_);
+
+    // identical request already cached or in flight: share its result
+    const auto it = results_.find(key);
+    if (it != results_.end()) {
+        if (cached != nullptr) {
+            *cached = true;
+        }
+        recency_.splice(recency_.begin(), recency_, it->second.second);
+        return it->second.first;
+    }
+
+    // new request: register its result and synthesize it on the thread pool,
+    // evicting the least recently used result if the cache is full
+    // (an evicted in-flight result still reaches the requests that share it)
+    if (static_cast<int>(results_.size()) >= cacheCapacity_) {
+        results_.erase(recency_.back());
+        recency_.pop_back();
+    }
+    auto promise = std::make_shared<std::promise<Response>>();
+    auto result = promise->get_future().share();
+    recency_.push_front(key);
+    results_.emplace(key, std::make_pair(result, recency_.begin()));
+    threadPool_.submit([promise, request]() { promise->set_value(synthesize_(request)); });
+
+    if (cached != nullptr) {
+        *cached = false;
+    }
+    return result;
+}
+
+std::string SynthesisService::handle(const std::string& line) noexcept {
+    const auto request = parseRequest(line);
+    if (!request.has_value()) {
+        return "error malformed request";
+    }
+
+    // submit the request and wait for its result
+    auto cached = false;
+    const auto response = submit(request.value(), &cached).get();
+    if (!response.ok) {
+        return "error " + response.error;
+    }
+
+    auto stream = std::ostringstream();
+    stream.precision(std::numeric_limits<Time>::max_digits10);
+    stream << "ok " << response.collectiveTime << ' ' << response.trials << ' '
+           << (cached ? "hit" : "miss");
+    return stream.str();
+}
+
+std::optional<SynthesisService::Request> SynthesisService::parseRequest(
+    const std::string& line) noexcept {
+    auto request = Request();
+    auto stream = std::istringstream(line);
+    stream >> request.topology >> request.collective >> request.chunkSize >> request.budget;
+    if (stream.fail() || request.chunkSize <= 0 || request.budget < 0) {
+        return std::nullopt;
+    }
+
+    // reject trailing tokens
+    auto trailing = std::string();
+    if (stream >> trailing) {
+        return std::nullopt;
+    }
+
+    return request;
+}
+
+SynthesisService::Response SynthesisService::synthesize_(const Request& request) noexcept {
+    if (request.budget > maxBudget) {
+        return {false, -1, 0, "budget exceeds the limit"};
+    }
+
+    // construct the topology and the collective, within the limits of the service
+    const auto topology = TopologyParser::parse(request.topology, maxNpusCount);
+    if (topology == nullptr || topology->npusCount() < 2) {
+        return {false, -1, 0, "invalid topology: " + request.topology};
+    }
+    const auto collective =
+        CollectiveParser::parse(request.collective, topology->npusCount(), maxCollectivesCount);
+    if (collective == nullptr || !transfers(*collective)) {
+        return {false, -1, 0, "invalid collective: " + request.collective};
+    }
+
+    // repeat the synthesis until the budget is spent, keeping the best result
+    auto synthesizer = Synthesizer();
+    auto timer = Timer();
+    auto collectiveTime = std::numeric_limits<Time>::max();
+    auto trials = 0;
+
+    timer.start();
+    do {
+        const auto result = synthesizer.solve(*topology, *collective, request.chunkSize);
+        collectiveTime = std::min(collectiveTime, result.collectiveTime());
+        trials++;
+        timer.stop();
+    } while (timer.time() < request.budget * 1000);
+
+    if (collectiveTime <= 0) {
+        return {false, -1, trials, "synthesis failed"};
+    }
+    return {true, collectiveTime, trials, ""};
+}
@@ -0,0 +1,70 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cassert>
+#include <tacos/service/thread_pool.h>
+
+using namespace tacos;
+
+ThreadPool::ThreadPool(const int threadsCount) noexcept {
+    assert(threadsCount > 0);
+
+    workers_.reserve(threadsCount);
+    for (auto i = 0; i < threadsCount; i++) {
+        workers_.emplace_back([this]() { work_(); });
+    }
+}
+
+ThreadPool::~ThreadPool() noexcept {
+    // let the workers drain the remaining tasks and exit
+    {
+        const auto lock = std::lock_guard(mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(Task task) noexcept {
+    assert(task);
+
+    {
+        const auto lock = std::lock_guard(mutex_);
+        assert(!stopping_);
+        tasks_.push(std::move(task));
+    }
+    condition_.notify_one();
+}
+
+int ThreadPool::threadsCount() const noexcept {
+    return static_cast<int>(workers_.size());
+}
+
+void ThreadPool::work_() noexcept {
+    while (true) {
+        auto task = Task();
+
+        // wait until a task is available or the pool stops
+        {
+            auto lock = std::unique_lock(mutex_);
+            condition_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                // stopping and no task left
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop();
+        }
+
+        // run the task outside the lock
+        task();
+    }
+}
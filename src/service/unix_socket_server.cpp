@@ -0,0 +1,167 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <tacos/service/unix_socket_server.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace tacos;
+
+UnixSocketServer::UnixSocketServer(std::string path, Handler handler) noexcept
+    : path_(std::move(path)), handler_(std::move(handler)) {}
+
+UnixSocketServer::~UnixSocketServer() noexcept {
+    stop();
+    const auto socket = socket_.exchange(-1);
+    if (socket >= 0) {
+        close(socket);
+        unlink(path_.c_str());
+    }
+}
+
+bool UnixSocketServer::serve() noexcept {
+    // set up the socket address
+    auto address = sockaddr_un();
+    address.sun_family = AF_UNIX;
+    if (path_.size() >= sizeof(address.sun_path)) {
+        std::cerr << "Socket path too long: " << path_ << std::endl;
+        return false;
+    }
+    std::strncpy(address.sun_path, path_.c_str(), sizeof(address.sun_path) - 1);
+
+    // create, bind, and listen to the socket (replacing a stale socket file)
+    const auto listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        std::cerr << "Socket creation failed" << std::endl;
+        return false;
+    }
+    unlink(path_.c_str());
+    if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+        listen(listener, SOMAXCONN) < 0) {
+        std::cerr << "Socket binding failed: " << path_ << std::endl;
+        close(listener);
+        return false;
+    }
+    socket_ = listener;
+
+    // accept connections until stopped
+    auto stoppedNormally = true;
+    while (!stopping_) {
+        const auto connection = accept(listener, nullptr, nullptr);
+        if (connection < 0) {
+            if (stopping_ || errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM) {
+                // out of resources: back off until some connections are done
+                joinConnections_(false);
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                continue;
+            }
+            std::cerr << "Socket accept failed: " << std::strerror(errno) << std::endl;
+            stoppedNormally = false;
+            break;
+        }
+
+        // serve the connection on its own thread, and reclaim the finished ones
+        joinConnections_(false);
+        const auto lock = std::lock_guard(mutex_);
+        auto& served = connections_.emplace_back();
+        served.socket = connection;
+        served.thread = std::thread([this, &served]() {
+            // the peer sees the end of the connection, whose socket is closed once joined
+            handleConnection_(served.socket);
+            shutdown(served.socket, SHUT_RDWR);
+            served.done = true;
+        });
+    }
+
+    // shut down the open connections, then close the socket and remove its file
+    joinConnections_(true);
+    const auto socket = socket_.exchange(-1);
+    if (socket >= 0) {
+        close(socket);
+        unlink(path_.c_str());
+    }
+    return stoppedNormally;
+}
+
+void UnixSocketServer::stop() noexcept {
+    stopping_ = true;
+
+    // wake up a blocking accept()
+    const auto socket = socket_.load();
+    if (socket >= 0) {
+        shutdown(socket, SHUT_RDWR);
+    }
+}
+
+void UnixSocketServer::joinConnections_(const bool all) noexcept {
+    const auto lock = std::lock_guard(mutex_);
+    for (auto it = connections_.begin(); it != connections_.end();) {
+        if (all) {
+            // wake up a blocking read()
+            shutdown(it->socket, SHUT_RDWR);
+        } else if (!it->done) {
+            ++it;
+            continue;
+        }
+        it->thread.join();
+        close(it->socket);
+        it = connections_.erase(it);
+    }
+}
+
+void UnixSocketServer::handleConnection_(const int connection) const noexcept {
+    auto pending = std::string();
+    char buffer[4096];
+
+    while (true) {
+        const auto received = read(connection, buffer, sizeof(buffer));
+        if (received <= 0) {
+            // peer disconnected (or error)
+            break;
+        }
+        pending.append(buffer, received);
+
+        // handle every complete request line
+        auto lineEnd = pending.find('\n');
+        while (lineEnd != std::string::npos) {
+            const auto response = handler_(pending.substr(0, lineEnd)) + '\n';
+            pending.erase(0, lineEnd + 1);
+            if (!write_(connection, response)) {
+                return;
+            }
+            lineEnd = pending.find('\n');
+        }
+
+        // a request line may not grow without bounds
+        if (pending.size() > maxRequestLength) {
+            write_(connection, "error request too long\n");
+            return;
+        }
+    }
+}
+
+bool UnixSocketServer::write_(const int connection, const std::string& response) noexcept {
+    auto written = std::size_t(0);
+    while (written < response.size()) {
+        const auto sent = write(connection, response.data() + written, response.size() - written);
+        if (sent <= 0) {
+            return false;
+        }
+        written += sent;
+    }
+    return true;
+}
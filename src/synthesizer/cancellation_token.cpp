@@ -0,0 +1,22 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <tacos/synthesizer/cancellation_token.h>
+
+using namespace tacos;
+
+CancellationToken::CancellationToken() noexcept
+    : cancelled_(std::make_shared<std::atomic<bool>>(false)) {}
+
+void CancellationToken::cancel() noexcept {
+    cancelled_->store(true, std::memory_order_relaxed);
+}
+
+bool CancellationToken::cancelled() const noexcept {
+    return cancelled_->load(std::memory_order_relaxed);
+}
@@ -0,0 +1,204 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <limits>
+#include <tacos/event_queue/timer.h>
+#include <tacos/synthesizer/chunk_tuner.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/synthesizer/time_expanded_network.h>
+#include <unordered_map>
+#include <vector>
+
+using namespace tacos;
+
+ChunkTuner::ChunkTuner(const int maxCollectivesCount, const double budget) noexcept
+    : maxCollectivesCount_(maxCollectivesCount), budget_(budget) {
+    assert(maxCollectivesCount > 0);
+    assert(budget > 0);
+}
+
+std::optional<ChunkTuner::Result> ChunkTuner::tune(const Topology& topology,
+                                                   const CollectiveFactory& collectiveFactory,
+                                                   const ChunkSize bufferSize) const noexcept {
+    assert(bufferSize > 0);
+
+    // a candidate chunk count and its lower bound
+    struct Candidate {
+        int collectivesCount;
+        std::unique_ptr<Collective> collective;
+        ChunkSize chunkSize;
+        Time bound;
+    };
+
+    auto candidates = std::vector<Candidate>();
+    for (auto collectivesCount = 1; collectivesCount <= maxCollectivesCount_;
+         collectivesCount++) {
+        auto collective = collectiveFactory(collectivesCount);
+        assert(collective != nullptr);
+
+        // chunks cannot be smaller than a byte
+        const auto chunkSize = bufferSize / collective->chunksCount();
+        if (chunkSize <= 0) {
+            break;
+        }
+        const auto bound = lowerBound(topology, *collective, chunkSize);
+        candidates.push_back({collectivesCount, std::move(collective), chunkSize, bound});
+    }
+
+    // synthesize the most promising chunk counts first
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const Candidate& lhs, const Candidate& rhs) {
+                         return lhs.bound < rhs.bound;
+                     });
+
+    auto best = std::optional<Result>();
+    auto synthesizer = Synthesizer();
+    auto timer = Timer();
+    auto synthesizedCount = 0;
+    auto prunedCount = 0;
+    auto unfinishedCount = 0;
+    timer.start();
+
+    const auto candidatesCount = static_cast<int>(candidates.size());
+    for (auto i = 0; i < candidatesCount; i++) {
+        const auto& candidate = candidates[i];
+
+        // candidates are sorted by their bound: none of the rest can beat the best one
+        if (best.has_value() && candidate.bound >= best->collectiveTime) {
+            prunedCount = candidatesCount - i;
+            break;
+        }
+
+        // synthesize within the remaining budget, cancelling the synthesis if it runs out
+        timer.stop();
+        const auto remaining = (budget_ * 1000) - timer.time();  // microseconds
+        if (remaining <= 0) {
+            unfinishedCount = candidatesCount - i;
+            break;
+        }
+        auto cancellationToken = CancellationToken();
+        auto future = synthesizer.solveAsync(topology, *candidate.collective,
+                                             candidate.chunkSize, cancellationToken);
+        const auto timeout = std::chrono::duration<double, std::micro>(remaining);
+        if (future.wait_for(timeout) != std::future_status::ready) {
+            cancellationToken.cancel();
+            future.wait();
+            unfinishedCount = candidatesCount - i;
+            break;
+        }
+
+        const auto result = future.get();
+        assert(result.has_value());
+        synthesizedCount++;
+        const auto collectiveTime = result->collectiveTime();
+        if (!best.has_value() || collectiveTime < best->collectiveTime) {
+            best = Result{candidate.collectivesCount, collectiveTime, 0, 0, 0};
+        }
+    }
+
+    if (!best.has_value()) {
+        return std::nullopt;
+    }
+    best->synthesizedCount = synthesizedCount;
+    best->prunedCount = prunedCount;
+    best->unfinishedCount = unfinishedCount;
+    return best;
+}
+
+ChunkTuner::Time ChunkTuner::lowerBound(const Topology& topology,
+                                        const Collective& collective,
+                                        const ChunkSize chunkSize) noexcept {
+    assert(chunkSize > 0);
+    const auto npusCount = topology.npusCount();
+    const auto infinity = std::numeric_limits<Time>::max();
+
+    // link transfer times of a chunk, and all-pairs shortest-path times
+    const auto ten = TimeExpandedNetwork(topology, chunkSize);
+    const auto distance = ten.shortestPathTimes();
+
+    // a chunk with a size of its own takes at least scale times as long as a chunk of
+    // chunkSize over every link, and thus over every path
+    auto scales = std::unordered_map<ChunkSize, double>();
+    const auto scale = [&](const Collective::ChunkID chunk) {
+        const auto size = collective.size(chunk);
+        if (size <= 0) {
+            return 1.0;
+        }
+        const auto [it, inserted] = scales.emplace(size, infinity);
+        if (inserted) {
+            for (auto src = 0; src < npusCount; src++) {
+                for (auto dest = 0; dest < npusCount; dest++) {
+                    if (src != dest && topology.connected(src, dest)) {
+                        const auto ratio = ten.linkTransferTime(src, dest, size) /
+                                           ten.linkTransferTime(src, dest);
+                        it->second = std::min(it->second, ratio);
+                    }
+                }
+            }
+        }
+        return it->second;
+    };
+
+    // (i) every chunk must travel to each of its destinations,
+    // while counting the chunks (of chunkSize) every NPU must receive and send
+    auto bound = Time(0);
+    auto recvCounts = std::vector<double>(npusCount, 0);
+    auto sendCounts = std::vector<double>(npusCount, 0);
+    for (auto chunk = 0; chunk < collective.chunksCount(); chunk++) {
+        const auto src = collective.precondition(chunk);
+        const auto chunkScale = scale(chunk);
+        const auto& replicas = collective.replicas(chunk);
+        auto leavesSrc = false;
+        for (const auto dest : collective.postcondition(chunk)) {
+            // a replicated chunk travels from its nearest holder
+            auto pathTime = distance[src][dest];
+            for (const auto replica : replicas) {
+                pathTime = std::min(pathTime, distance[replica][dest]);
+            }
+            if (pathTime == 0) {
+                continue;
+            }
+            assert(pathTime < infinity);
+            bound = std::max(bound, pathTime * chunkScale);
+            recvCounts[dest] += chunkScale;
+            leavesSrc = true;
+        }
+        // (the holders of a replicated chunk may share sending it)
+        if (leavesSrc && replicas.empty()) {
+            sendCounts[src] += chunkScale;
+        }
+    }
+
+    // (ii) in time T, a link of transfer time t carries at most T / t chunks
+    for (auto npu = 0; npu < npusCount; npu++) {
+        auto ingressRate = 0.0;  // chunks per microsecond
+        auto egressRate = 0.0;
+        for (auto peer = 0; peer < npusCount; peer++) {
+            if (peer == npu) {
+                continue;
+            }
+            if (topology.connected(peer, npu)) {
+                ingressRate += 1 / ten.linkTransferTime(peer, npu);
+            }
+            if (topology.connected(npu, peer)) {
+                egressRate += 1 / ten.linkTransferTime(npu, peer);
+            }
+        }
+        if (recvCounts[npu] > 0) {
+            bound = std::max(bound, recvCounts[npu] / ingressRate);
+        }
+        if (sendCounts[npu] > 0) {
+            bound = std::max(bound, sendCounts[npu] / egressRate);
+        }
+    }
+
+    return bound;
+}
@@ -0,0 +1,154 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <tacos/synthesizer/concurrent_synthesizer.h>
+#include <unordered_map>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief A transfer of the joint schedule
+struct Transfer {
+    /// @brief source NPU ID
+    Topology::NpuID src;
+
+    /// @brief destination NPU ID
+    Topology::NpuID dest;
+
+    /// @brief send op at src
+    const CommOp* send;
+
+    /// @brief recv op at dest
+    const CommOp* recv;
+};
+
+}  // namespace
+
+Synthesizer& ConcurrentSynthesizer::synthesizer() noexcept {
+    return synthesizer_;
+}
+
+ConcurrentSynthesizer::Result ConcurrentSynthesizer::solve(const Topology& topology,
+                                                           const ConcurrentCollective& collective,
+                                                           const ChunkSize chunkSize) noexcept {
+    auto synthesisResult = synthesizer_.solve(topology, collective, chunkSize);
+    return split(topology, collective, synthesisResult, synthesizer_.reductionTime(chunkSize));
+}
+
+ConcurrentSynthesizer::Result ConcurrentSynthesizer::split(
+    const Topology& topology,
+    const ConcurrentCollective& collective,
+    SynthesisResult& synthesisResult,
+    const Time reductionTime) noexcept {
+    const auto npusCount = topology.npusCount();
+    const auto groupsCount = collective.groupsCount();
+
+    // gather the transfers of the joint schedule:
+    // both ends record the ops of a link in the same order
+    auto transfers = std::vector<Transfer>();
+    auto deliverers = std::unordered_map<const CommOp*, int>();
+    for (auto src = 0; src < npusCount; src++) {
+        for (const auto& [dest, link] : synthesisResult.npu(src).egressLinks()) {
+            const auto& recvOps = synthesisResult.npu(dest).linkFrom(src).ops();
+            for (const auto& [opId, op] : link.ops()) {
+                const auto* const recv = &recvOps.at(opId);
+                deliverers[recv] = static_cast<int>(transfers.size());
+                transfers.push_back({src, dest, &op, recv});
+            }
+        }
+    }
+
+    // replay the transfers in time order, so that every op follows its dependencies:
+    // rank: length of the chain of same-time dependencies leading to a transfer
+    // (a send may depend on a recv of the same time when a replacement chunk was forwarded)
+    auto ranks = std::vector<int>(transfers.size(), -1);
+    const std::function<int(int)> rank = [&](const int index) {
+        if (ranks[index] >= 0) {
+            return ranks[index];
+        }
+        auto transferRank = 0;
+        const auto& transfer = transfers[index];
+        for (const auto* const op : {transfer.send, transfer.recv}) {
+            if (op->hasDep() && op->depOp()->time() == op->time()) {
+                const auto deliverer = deliverers.find(op->depOp());
+                if (deliverer != deliverers.end() && deliverer->second != index) {
+                    transferRank = std::max(transferRank, rank(deliverer->second) + 1);
+                }
+            }
+        }
+        ranks[index] = transferRank;
+        return transferRank;
+    };
+    auto order = std::vector<int>(transfers.size());
+    for (auto index = 0; index < static_cast<int>(transfers.size()); index++) {
+        order[index] = index;
+    }
+    std::sort(order.begin(), order.end(), [&](const int lhs, const int rhs) {
+        return std::make_pair(transfers[lhs].recv->time(), rank(lhs)) <
+               std::make_pair(transfers[rhs].recv->time(), rank(rhs));
+    });
+
+    // record every transfer into the schedule of its group
+    auto result = Result();
+    result.synthesisResults.reserve(groupsCount);
+    for (auto group = 0; group < groupsCount; group++) {
+        result.synthesisResults.emplace_back(topology, collective.member(group));
+    }
+    result.completionTimes.assign(groupsCount, 0);
+    auto reductionArrivals = std::vector<std::vector<Time>>(collective.chunksCount());
+    for (const auto index : order) {
+        const auto& [src, dest, send, recv] = transfers[index];
+        const auto jointChunk = send->chunkId();
+        const auto group = collective.group(jointChunk);
+        const auto chunk = jointChunk - collective.firstChunk(group);
+        const auto time = recv->time();
+        auto& groupResult = result.synthesisResults[group];
+        groupResult.npu(src).linkTo(dest).send(chunk, time);
+        groupResult.npu(dest).linkFrom(src).recv(chunk, time, recv->reduction());
+
+        // a group completes once its chunks reach their destinations,
+        // or once they are reduced at their owners (see below)
+        const auto& member = collective.member(group);
+        if (recv->reduction()) {
+            if (member.precondition(chunk) == dest) {
+                reductionArrivals[jointChunk].push_back(time);
+            }
+        } else if (member.postcondition(chunk).count(dest) > 0) {
+            result.completionTimes[group] = std::max(result.completionTimes[group], time);
+        }
+    }
+
+    // the partial chunks are reduced at their owner one at a time, in their order of arrival,
+    // once released (as in TimeReversal)
+    if (collective.reduction()) {
+        for (auto jointChunk = 0; jointChunk < collective.chunksCount(); jointChunk++) {
+            auto& arrivals = reductionArrivals[jointChunk];
+            std::sort(arrivals.begin(), arrivals.end());
+            auto reducedTime = collective.releaseTime(jointChunk);
+            for (const auto arrival : arrivals) {
+                reducedTime = std::max(reducedTime, arrival) + reductionTime;
+            }
+            const auto group = collective.group(jointChunk);
+            result.completionTimes[group] = std::max(result.completionTimes[group], reducedTime);
+        }
+    }
+
+    result.makespan = 0;
+    for (auto group = 0; group < groupsCount; group++) {
+        const auto completionTime = result.completionTimes[group];
+        if (completionTime > 0) {
+            result.synthesisResults[group].collectiveTime(completionTime);
+        }
+        result.makespan = std::max(result.makespan, completionTime);
+    }
+    return result;
+}
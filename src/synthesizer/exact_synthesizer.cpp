@@ -0,0 +1,596 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <bitset>
+#include <cassert>
+#include <limits>
+#include <tacos/synthesizer/exact_synthesizer.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/synthesizer/time_expanded_network.h>
+#include <thread>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief number of Synthesizer schedules seeding the incumbent
+constexpr int seedsCount = 8;
+
+/// @brief minimum number of split-depth subtrees per worker thread
+constexpr int subtreesPerThread = 8;
+
+/// @brief number of cuts bounding the search, besides the single NPUs
+constexpr int maxCutsCount = 16;
+
+/// @brief deepest split depth tried
+constexpr int maxSplitDepth = 32;
+
+/// @brief number of nodes visited between two checks of the search budget
+constexpr int64_t checkInterval = 1024;
+
+}  // namespace
+
+ExactSynthesizer::ExactSynthesizer(const double budget, const int threadsCount) noexcept
+    : budget_(budget),
+      threadsCount_(threadsCount) {
+    assert(budget > 0);
+    assert(threadsCount > 0);
+}
+
+std::optional<ExactSynthesizer::Result> ExactSynthesizer::solve(
+    const Topology& topology, const Collective& collective, const ChunkSize chunkSize) noexcept {
+    assert(chunkSize > 0);
+    assert(!collective.reduction());
+    assert(!collective.sized());
+    assert(!collective.staggered());
+
+    if (topology.npusCount() > maxNpusCount) {
+        return std::nullopt;
+    }
+
+    auto root = root_(topology, collective, chunkSize);
+    bestTime_ = std::numeric_limits<Time>::max();
+    bestTransfers_.clear();
+    stopped_ = false;
+    nextTicket_ = 0;
+
+    // seed the incumbent, which may already meet the lower bound
+    seed_(topology, collective, chunkSize, root);
+    const auto lowerBound = (root.remaining > 0) ? bound_(root) : Time(0);
+    auto nodesCount = int64_t(0);
+
+    if (bestTime_ > lowerBound && !isEqual(bestTime_, lowerBound)) {
+        // split the tree deep enough to balance the subtrees across the workers
+        splitDepth_ = -1;
+        if (threadsCount_ > 1) {
+            for (auto depth = 1; depth <= maxSplitDepth; depth++) {
+                if (count_(root, depth) >= int64_t(subtreesPerThread) * threadsCount_) {
+                    splitDepth_ = depth;
+                    break;
+                }
+            }
+        }
+        const auto workersCount = (splitDepth_ < 0) ? 1 : threadsCount_;
+
+        auto states = std::vector<State>(workersCount, root);
+        auto workers = std::vector<std::thread>();
+        for (auto& state : states) {
+            state.ticket = nextTicket_++;
+            workers.emplace_back([this, &state] { search_(state, 0, 0); });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (const auto& state : states) {
+            nodesCount += state.nodesCount;
+        }
+    }
+
+    if (bestTime_ == std::numeric_limits<Time>::max()) {
+        return std::nullopt;
+    }
+
+    const auto optimal = !stopped_;
+    return Result{result_(topology, collective, bestTransfers_), optimal,
+                  optimal ? bestTime_.load() : lowerBound, nodesCount};
+}
+
+ExactSynthesizer::State ExactSynthesizer::root_(const Topology& topology,
+                                                const Collective& collective,
+                                                const ChunkSize chunkSize) noexcept {
+    npusCount_ = topology.npusCount();
+    chunksCount_ = collective.chunksCount();
+
+    const auto ten = TimeExpandedNetwork(topology, chunkSize);
+    pathTimes_ = ten.shortestPathTimes();
+
+    auto state = State();
+    state.time = 0;
+    state.remaining = 0;
+    state.nodesCount = 0;
+    state.splitNodesCount = 0;
+    state.ticket = -1;
+    state.countDepth = -1;
+
+    // links, in (src, dest) order
+    for (auto src = 0; src < npusCount_; src++) {
+        for (auto dest = 0; dest < npusCount_; dest++) {
+            if (!topology.connected(src, dest)) {
+                continue;
+            }
+            state.links.push_back({src, dest, ten.linkTransferTime(src, dest), -1, -1, -1});
+        }
+    }
+
+    // chunks start at their precondition
+    destinations_.assign(chunksCount_, 0);
+    classes_.assign(chunksCount_, -1);
+    state.holders.assign(chunksCount_, 0);
+    state.incoming.assign(chunksCount_, 0);
+    state.arrivals.assign(chunksCount_ * npusCount_, -1);
+    for (auto chunk = 0; chunk < chunksCount_; chunk++) {
+        for (const auto dest : collective.postcondition(chunk)) {
+            destinations_[chunk] |= NpuMask(1) << dest;
+        }
+        auto sources = collective.replicas(chunk);
+        sources.push_back(collective.precondition(chunk));
+        for (const auto src : sources) {
+            state.holders[chunk] |= NpuMask(1) << src;
+            state.arrivals[chunk * npusCount_ + src] = 0;
+        }
+        const auto missing = destinations_[chunk] & ~state.holders[chunk];
+        state.remaining += static_cast<int>(std::bitset<32>(missing).count());
+
+        // chunks with the same sources and destinations are interchangeable
+        classes_[chunk] = chunk;
+        for (auto other = 0; other < chunk; other++) {
+            if (state.holders[other] == state.holders[chunk] &&
+                destinations_[other] == destinations_[chunk]) {
+                classes_[chunk] = other;
+                break;
+            }
+        }
+    }
+
+    selectCuts_(state);
+    state.timer.start();
+    return state;
+}
+
+void ExactSynthesizer::seed_(const Topology& topology,
+                             const Collective& collective,
+                             const ChunkSize chunkSize,
+                             const State& root) noexcept {
+    auto synthesizer = Synthesizer();
+    for (auto i = 0; i < seedsCount; i++) {
+        auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+        const auto transfers = replay_(synthesisResult, root);
+        if (!transfers.has_value()) {
+            continue;
+        }
+        const auto collectiveTime = transfers->empty() ? Time(0) : transfers->back().end;
+        if (collectiveTime < bestTime_ && !isEqual(collectiveTime, bestTime_)) {
+            bestTime_ = collectiveTime;
+            bestTransfers_ = *transfers;
+        }
+    }
+}
+
+std::optional<std::vector<ExactSynthesizer::Transfer>> ExactSynthesizer::replay_(
+    SynthesisResult& synthesisResult, const State& root) const noexcept {
+    auto transfers = std::vector<Transfer>();
+    for (auto src = 0; src < npusCount_; src++) {
+        for (const auto& [dest, link] : synthesisResult.npu(src).egressLinks()) {
+            for (const auto& [opId, op] : link.ops()) {
+                transfers.push_back({src, dest, op.chunkId(), op.time()});
+            }
+        }
+    }
+    std::stable_sort(transfers.begin(), transfers.end(),
+                     [](const Transfer& lhs, const Transfer& rhs) { return lhs.end < rhs.end; });
+
+    // a replaced chunk may have been sent before it arrived at its source:
+    // such a schedule is outside of the search model, and cannot bound it
+    auto arrivals = root.arrivals;
+    for (const auto& [src, dest, chunk, end] : transfers) {
+        const auto link = std::find_if(root.links.begin(), root.links.end(),
+                                       [src = src, dest = dest](const Link& candidate) {
+                                           return candidate.src == src && candidate.dest == dest;
+                                       });
+        assert(link != root.links.end());
+        const auto ready = arrivals[chunk * npusCount_ + src];
+        const auto start = end - link->duration;
+        if (ready < 0 || (ready > start && !isEqual(ready, start))) {
+            return std::nullopt;
+        }
+        arrivals[chunk * npusCount_ + dest] = end;
+    }
+    return transfers;
+}
+
+void ExactSynthesizer::search_(State& state, const int depth, const int first) noexcept {
+    if (stopped_) {
+        return;
+    }
+
+    const auto counting = (state.countDepth >= 0);
+    if (!counting && ++state.nodesCount % checkInterval == 0) {
+        state.timer.stop();
+        if (state.timer.time() / 1000 >= budget_) {  // milliseconds
+            stopped_ = true;
+            return;
+        }
+    }
+
+    if (state.remaining == 0) {
+        if (!counting) {
+            offer_(state);
+        }
+        return;
+    }
+
+    if (counting && depth == state.countDepth) {
+        state.splitNodesCount++;
+        return;
+    }
+
+    // every worker walks the tree above the split depth (unpruned, so that they all meet
+    // the same nodes), and searches the split-depth subtrees it claims
+    if (depth == splitDepth_) {
+        if (state.splitNodesCount++ != state.ticket) {
+            return;
+        }
+        state.ticket = nextTicket_++;
+    }
+
+    const auto pruning = (!counting && depth >= splitDepth_);
+    if (pruning) {
+        const auto bound = bound_(state);
+        if (bound >= bestTime_ || isEqual(bound, bestTime_)) {
+            return;
+        }
+    }
+
+    // next free link with a chunk to send at this event
+    const auto linksCount = static_cast<int>(state.links.size());
+    auto index = first;
+    auto candidates = std::vector<std::pair<Time, ChunkID>>();
+    for (; index < linksCount; index++) {
+        if (state.links[index].busyUntil < 0) {
+            candidates = candidates_(state, index);
+            if (!candidates.empty()) {
+                break;
+            }
+        }
+    }
+    if (index == linksCount) {
+        advance_(state, depth);
+        return;
+    }
+
+    auto& link = state.links[index];
+    const auto bit = NpuMask(1) << link.dest;
+    const auto idleSince = link.idleSince;
+
+    // a chunk sent now would arrive too late to beat the incumbent
+    const auto arrival = state.time + link.duration;
+    if (pruning && (arrival >= bestTime_ || isEqual(arrival, bestTime_))) {
+        candidates.clear();
+    }
+
+    // either send a candidate chunk, or leave the link idle,
+    // which is tried before the chunks arriving later than along their shortest path
+    const auto candidatesCount = static_cast<int>(candidates.size());
+    auto idled = false;
+    for (auto i = 0; i <= candidatesCount; i++) {
+        const auto late = (i < candidatesCount && !isEqual(candidates[i].first, 0));
+        if (!idled && (i == candidatesCount || late)) {
+            idled = true;
+            if (idleSince < 0) {
+                link.idleSince = state.time;
+            }
+            search_(state, depth + 1, index + 1);
+            link.idleSince = idleSince;
+        }
+        if (i == candidatesCount) {
+            break;
+        }
+
+        const auto chunk = candidates[i].second;
+        link.busyUntil = state.time + link.duration;
+        link.chunk = chunk;
+        link.idleSince = -1;
+        state.incoming[chunk] |= bit;
+        state.arrivals[chunk * npusCount_ + link.dest] = link.busyUntil;
+
+        search_(state, depth + 1, index + 1);
+
+        state.arrivals[chunk * npusCount_ + link.dest] = -1;
+        state.incoming[chunk] &= ~bit;
+        link.busyUntil = -1;
+        link.chunk = -1;
+        link.idleSince = idleSince;
+    }
+}
+
+void ExactSynthesizer::advance_(State& state, const int depth) noexcept {
+    auto next = std::numeric_limits<Time>::max();
+    for (const auto& link : state.links) {
+        if (link.busyUntil >= 0) {
+            next = std::min(next, link.busyUntil);
+        }
+    }
+
+    // every link is idle: no schedule completes from here
+    if (next == std::numeric_limits<Time>::max()) {
+        return;
+    }
+
+    // deliver the chunks arriving at the next event
+    const auto time = state.time;
+    state.time = next;
+    auto delivered = std::vector<int>();
+    const auto linksCount = static_cast<int>(state.links.size());
+    for (auto index = 0; index < linksCount; index++) {
+        auto& link = state.links[index];
+        if (link.busyUntil < 0 || !isEqual(link.busyUntil, next)) {
+            continue;
+        }
+        const auto bit = NpuMask(1) << link.dest;
+        state.holders[link.chunk] |= bit;
+        state.incoming[link.chunk] &= ~bit;
+        if ((destinations_[link.chunk] & bit) != 0) {
+            state.remaining--;
+        }
+        state.transfers.push_back({link.src, link.dest, link.chunk, link.busyUntil});
+        link.busyUntil = -1;
+        link.chunk = -1;
+        delivered.push_back(index);
+    }
+
+    search_(state, depth + 1, 0);
+
+    // then, take them back
+    for (auto it = delivered.rbegin(); it != delivered.rend(); it++) {
+        auto& link = state.links[*it];
+        const auto& transfer = state.transfers.back();
+        assert(transfer.src == link.src && transfer.dest == link.dest);
+        const auto bit = NpuMask(1) << link.dest;
+        link.busyUntil = transfer.end;
+        link.chunk = transfer.chunk;
+        state.holders[link.chunk] &= ~bit;
+        state.incoming[link.chunk] |= bit;
+        if ((destinations_[link.chunk] & bit) != 0) {
+            state.remaining++;
+        }
+        state.transfers.pop_back();
+    }
+    state.time = time;
+}
+
+std::vector<std::pair<ExactSynthesizer::Time, ExactSynthesizer::ChunkID>>
+ExactSynthesizer::candidates_(const State& state, const int link) const noexcept {
+    const auto infinity = std::numeric_limits<Time>::max();
+    const auto& [src, dest, duration, busyUntil, inFlight, idleSince] = state.links[link];
+    const auto srcBit = NpuMask(1) << src;
+    const auto destBit = NpuMask(1) << dest;
+    const auto arrival = state.time + duration;
+
+    auto candidates = std::vector<std::pair<Time, ChunkID>>();
+    for (auto chunk = 0; chunk < chunksCount_; chunk++) {
+        const auto holders = state.holders[chunk];
+        const auto reached = holders | state.incoming[chunk];
+        if ((holders & srcBit) == 0 || (reached & destBit) != 0) {
+            continue;
+        }
+
+        // relay through a non-destination NPU only while some destination misses the chunk
+        if ((destinations_[chunk] & destBit) == 0 && (destinations_[chunk] & ~reached) == 0) {
+            continue;
+        }
+
+        // an idle link could have sent the chunk earlier already
+        const auto ready = state.arrivals[chunk * npusCount_ + src];
+        if (idleSince >= 0 && (ready < idleSince || isEqual(ready, idleSince))) {
+            continue;
+        }
+
+        // an interchangeable chunk in the same state is already a candidate
+        const auto symmetric = std::any_of(
+            candidates.begin(), candidates.end(), [&](const std::pair<Time, ChunkID>& other) {
+                const auto [otherLateness, otherChunk] = other;
+                if (classes_[otherChunk] != classes_[chunk] ||
+                    state.holders[otherChunk] != holders ||
+                    state.incoming[otherChunk] != state.incoming[chunk]) {
+                    return false;
+                }
+                for (auto npu = 0; npu < npusCount_; npu++) {
+                    if (!isEqual(state.arrivals[otherChunk * npusCount_ + npu],
+                                 state.arrivals[chunk * npusCount_ + npu])) {
+                        return false;
+                    }
+                }
+                return true;
+            });
+        if (symmetric) {
+            continue;
+        }
+
+        // lateness of the arrival, compared to the shortest path from any holder (or receiver)
+        auto earliest = arrival;
+        for (auto npu = 0; npu < npusCount_; npu++) {
+            if ((reached & (NpuMask(1) << npu)) != 0 && pathTimes_[npu][dest] != infinity) {
+                const auto start = std::max(state.time, state.arrivals[chunk * npusCount_ + npu]);
+                earliest = std::min(earliest, start + pathTimes_[npu][dest]);
+            }
+        }
+        candidates.emplace_back(arrival - earliest, chunk);
+    }
+
+    // punctual and rare chunks first, to find good schedules early
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [&state](const std::pair<Time, ChunkID>& lhs,
+                              const std::pair<Time, ChunkID>& rhs) {
+                         if (!isEqual(lhs.first, rhs.first)) {
+                             return lhs.first < rhs.first;
+                         }
+                         return std::bitset<32>(state.holders[lhs.second]).count() <
+                                std::bitset<32>(state.holders[rhs.second]).count();
+                     });
+    return candidates;
+}
+
+ExactSynthesizer::Time ExactSynthesizer::bound_(const State& state) const noexcept {
+    const auto infinity = std::numeric_limits<Time>::max();
+    auto bound = state.time;
+
+    // (i) every missing chunk must travel from its closest holder (or receiver)
+    for (auto chunk = 0; chunk < chunksCount_; chunk++) {
+        const auto reached = state.holders[chunk] | state.incoming[chunk];
+        const auto missing = destinations_[chunk] & ~state.holders[chunk];
+        if (missing == 0) {
+            continue;
+        }
+        for (auto dest = 0; dest < npusCount_; dest++) {
+            if ((missing & (NpuMask(1) << dest)) == 0) {
+                continue;
+            }
+            auto arrival = infinity;
+            for (auto npu = 0; npu < npusCount_; npu++) {
+                if ((reached & (NpuMask(1) << npu)) == 0 || pathTimes_[npu][dest] == infinity) {
+                    continue;
+                }
+                const auto ready = std::max(state.time, state.arrivals[chunk * npusCount_ + npu]);
+                arrival = std::min(arrival, ready + pathTimes_[npu][dest]);
+            }
+            bound = std::max(bound, arrival);
+        }
+    }
+
+    // (ii) the chunks missing in every cut must cross it over its ingress links
+    const auto cutsCount = static_cast<int>(cuts_.size());
+    for (auto cut = 0; cut < cutsCount; cut++) {
+        bound = std::max(bound, cutBound_(state, cuts_[cut], cutLinks_[cut]));
+    }
+
+    return bound;
+}
+
+ExactSynthesizer::Time ExactSynthesizer::cutBound_(const State& state,
+                                                  const NpuMask cut,
+                                                  const std::vector<int>& links) const noexcept {
+    // chunks some NPU of the cut misses, while no NPU of the cut holds or receives them
+    auto missingCount = 0;
+    for (auto chunk = 0; chunk < chunksCount_; chunk++) {
+        const auto reached = state.holders[chunk] | state.incoming[chunk];
+        if ((destinations_[chunk] & cut & ~reached) != 0 && (reached & cut) == 0) {
+            missingCount++;
+        }
+    }
+    if (missingCount == 0) {
+        return 0;
+    }
+    if (links.empty()) {
+        return std::numeric_limits<Time>::max();
+    }
+
+    // each ingress link sends one chunk at a time once it is free:
+    // the last missing chunk crosses no earlier than the missingCount-th earliest arrival
+    auto frees = std::vector<Time>();
+    for (const auto index : links) {
+        frees.push_back(std::max(state.time, state.links[index].busyUntil));
+    }
+    const auto linksCount = static_cast<int>(links.size());
+    auto arrival = Time(0);
+    for (auto i = 0; i < missingCount; i++) {
+        auto earliest = 0;
+        for (auto j = 1; j < linksCount; j++) {
+            if (frees[j] + state.links[links[j]].duration <
+                frees[earliest] + state.links[links[earliest]].duration) {
+                earliest = j;
+            }
+        }
+        frees[earliest] += state.links[links[earliest]].duration;
+        arrival = frees[earliest];
+    }
+    return arrival;
+}
+
+void ExactSynthesizer::selectCuts_(const State& root) noexcept {
+    const auto ingress = [&root](const NpuMask cut) {
+        auto links = std::vector<int>();
+        for (auto index = 0; index < static_cast<int>(root.links.size()); index++) {
+            const auto& link = root.links[index];
+            if ((cut & (NpuMask(1) << link.dest)) != 0 && (cut & (NpuMask(1) << link.src)) == 0) {
+                links.push_back(index);
+            }
+        }
+        return links;
+    };
+
+    // every single NPU is a cut
+    cuts_.clear();
+    cutLinks_.clear();
+    for (auto npu = 0; npu < npusCount_; npu++) {
+        cuts_.push_back(NpuMask(1) << npu);
+        cutLinks_.push_back(ingress(cuts_.back()));
+    }
+
+    // along with the other cuts binding the tightest at the root (e.g., bisections)
+    auto bounds = std::vector<std::pair<Time, NpuMask>>();
+    const auto all = (NpuMask(1) << npusCount_) - 1;
+    for (auto cut = NpuMask(1); cut < all; cut++) {
+        if (std::bitset<32>(cut).count() > 1) {
+            bounds.emplace_back(cutBound_(root, cut, ingress(cut)), cut);
+        }
+    }
+    const auto selectedCount = std::min(static_cast<int>(bounds.size()), maxCutsCount);
+    std::partial_sort(bounds.begin(), bounds.begin() + selectedCount, bounds.end(),
+                      [](const std::pair<Time, NpuMask>& lhs, const std::pair<Time, NpuMask>& rhs) {
+                          return lhs.first > rhs.first;
+                      });
+    for (auto i = 0; i < selectedCount; i++) {
+        cuts_.push_back(bounds[i].second);
+        cutLinks_.push_back(ingress(bounds[i].second));
+    }
+}
+
+void ExactSynthesizer::offer_(const State& state) noexcept {
+    const auto lock = std::lock_guard<std::mutex>(mutex_);
+    if (state.time < bestTime_ && !isEqual(state.time, bestTime_)) {
+        bestTime_ = state.time;
+        bestTransfers_ = state.transfers;
+    }
+}
+
+int64_t ExactSynthesizer::count_(const State& root, const int depth) noexcept {
+    const auto splitDepth = splitDepth_;
+    splitDepth_ = -1;
+
+    auto state = root;
+    state.countDepth = depth;
+    search_(state, 0, 0);
+
+    splitDepth_ = splitDepth;
+    return state.splitNodesCount;
+}
+
+SynthesisResult ExactSynthesizer::result_(const Topology& topology,
+                                          const Collective& collective,
+                                          const std::vector<Transfer>& transfers) noexcept {
+    auto synthesisResult = SynthesisResult(topology, collective);
+    auto collectiveTime = Time(0);
+    for (const auto& [src, dest, chunk, end] : transfers) {
+        synthesisResult.npu(src).linkTo(dest).send(chunk, end);
+        synthesisResult.npu(dest).linkFrom(src).recv(chunk, end);
+        collectiveTime = std::max(collectiveTime, end);
+    }
+    synthesisResult.collectiveTime(collectiveTime);
+    return synthesisResult;
+}
@@ -0,0 +1,347 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <limits>
+#include <numeric>
+#include <tacos/event_queue/timer.h>
+#include <tacos/synthesizer/local_search.h>
+#include <tacos/synthesizer/time_expanded_network.h>
+
+using namespace tacos;
+
+LocalSearch::LocalSearch(const double budget) noexcept : budget_(budget) {
+    assert(budget > 0);
+}
+
+void LocalSearch::seed(const std::mt19937::result_type seed) noexcept {
+    randomEngine_.seed(seed);
+}
+
+bool LocalSearch::improve(const Topology& topology,
+                          const Collective& collective,
+                          const ChunkSize chunkSize,
+                          SynthesisResult& synthesisResult) noexcept {
+    assert(chunkSize > 0);
+    assert(!collective.reduction());
+    assert(!collective.sized());
+    assert(!collective.staggered());
+
+    auto timer = Timer();
+    timer.start();
+
+    // start every transfer as soon as possible
+    build_(topology, collective, chunkSize, synthesisResult);
+    auto all = std::vector<int>(transfers_.size());
+    std::iota(all.begin(), all.end(), 0);
+    [[maybe_unused]] const auto retimed = retime_(all, std::numeric_limits<Time>::max());
+    assert(retimed);
+    undoLog_.clear();
+    if (transfers_.empty()) {
+        return false;
+    }
+
+    auto [makespan, criticalCount] = makespan_();
+    auto coin = std::bernoulli_distribution(0.5);
+    auto uniform = std::uniform_real_distribution<>(0, 1);
+
+    while (true) {
+        timer.stop();
+        const auto elapsed = timer.time() / 1000;  // milliseconds
+        if (elapsed >= budget_) {
+            break;
+        }
+
+        // draw a transfer on a critical path
+        const auto transfer = criticalTransfer_(makespan);
+        const auto [src, dest, chunk, duration, end, position] = transfers_[transfer];
+
+        // other links into dest whose source receives the chunk
+        auto sources = std::vector<NpuID>();
+        for (auto npu = 0; npu < npusCount_; npu++) {
+            const auto holds = (sources_[chunk][npu] || deliverers_[chunk][npu] >= 0);
+            if (npu != src && npu != dest && linkTimes_[npu][dest] >= 0 && holds) {
+                sources.push_back(npu);
+            }
+        }
+
+        // move the transfer ahead of the previous transfer of its link,
+        // or reroute it, right after its chunk arrives at the new source
+        auto newSrc = src;
+        auto newPosition = position - 1;
+        if (!sources.empty() && (position == 0 || coin(randomEngine_))) {
+            auto dist = std::uniform_int_distribution<>(0, sources.size() - 1);
+            newSrc = sources[dist(randomEngine_)];
+            const auto deliverer = deliverers_[chunk][newSrc];
+            const auto ready = (deliverer >= 0) ? transfers_[deliverer].end : 0;
+            const auto& link = links_[newSrc][dest];
+            newPosition = static_cast<int>(link.size());
+            for (auto i = 0; i < static_cast<int>(link.size()); i++) {
+                const auto& next = transfers_[link[i]];
+                if (next.end - next.duration >= ready) {
+                    newPosition = i;
+                    break;
+                }
+            }
+        } else if (position == 0) {
+            continue;
+        }
+
+        // re-time the transfers downstream, abandoning the move once it delays the schedule
+        const auto seeds = move_(transfer, newSrc, newPosition);
+        auto accepted = retime_(seeds, makespan);
+        if (accepted) {
+            const auto [newMakespan, newCriticalCount] = makespan_();
+            const auto temperature = 0.5 * (1 - elapsed / budget_);
+            if (newMakespan < makespan && !isEqual(newMakespan, makespan)) {
+                accepted = true;
+            } else if (newCriticalCount != criticalCount) {
+                accepted = (newCriticalCount < criticalCount);
+            } else {
+                accepted = (uniform(randomEngine_) < temperature);
+            }
+            if (accepted) {
+                makespan = newMakespan;
+                criticalCount = newCriticalCount;
+            }
+        }
+
+        // roll the move back if rejected
+        if (!accepted) {
+            std::ignore = move_(transfer, src, position);
+            undo_();
+        }
+        undoLog_.clear();
+    }
+
+    // replace the schedule only if it got shorter
+    const auto collectiveTime = synthesisResult.collectiveTime();
+    if (makespan >= collectiveTime || isEqual(makespan, collectiveTime)) {
+        return false;
+    }
+    synthesisResult = result_(topology, collective);
+    return true;
+}
+
+void LocalSearch::build_(const Topology& topology,
+                         const Collective& collective,
+                         const ChunkSize chunkSize,
+                         SynthesisResult& synthesisResult) noexcept {
+    npusCount_ = topology.npusCount();
+    const auto chunksCount = collective.chunksCount();
+
+    // link transfer times
+    const auto ten = TimeExpandedNetwork(topology, chunkSize);
+    linkTimes_.assign(npusCount_, std::vector<Time>(npusCount_, -1));
+    for (auto src = 0; src < npusCount_; src++) {
+        for (auto dest = 0; dest < npusCount_; dest++) {
+            if (topology.connected(src, dest)) {
+                linkTimes_[src][dest] = ten.linkTransferTime(src, dest);
+            }
+        }
+    }
+
+    sources_.assign(chunksCount, std::vector<bool>(npusCount_, false));
+    for (auto chunk = 0; chunk < chunksCount; chunk++) {
+        sources_[chunk][collective.precondition(chunk)] = true;
+        for (const auto replica : collective.replicas(chunk)) {
+            sources_[chunk][replica] = true;
+        }
+    }
+
+    // the ops of every link are recorded in their order of arrival
+    transfers_.clear();
+    links_.assign(npusCount_, std::vector<std::vector<int>>(npusCount_));
+    deliverers_.assign(chunksCount, std::vector<int>(npusCount_, -1));
+    senders_.assign(chunksCount, std::vector<std::vector<int>>(npusCount_));
+    for (auto src = 0; src < npusCount_; src++) {
+        for (const auto& [dest, link] : synthesisResult.npu(src).egressLinks()) {
+            for (const auto& [opId, op] : link.ops()) {
+                const auto transfer = static_cast<int>(transfers_.size());
+                const auto chunk = op.chunkId();
+                auto& sequence = links_[src][dest];
+                transfers_.push_back({src, dest, chunk, linkTimes_[src][dest], op.time(),
+                                      static_cast<int>(sequence.size())});
+                sequence.push_back(transfer);
+                assert(deliverers_[chunk][dest] < 0);
+                deliverers_[chunk][dest] = transfer;
+                senders_[chunk][src].push_back(transfer);
+            }
+        }
+    }
+}
+
+LocalSearch::Time LocalSearch::start_(const int transfer) const noexcept {
+    const auto& [src, dest, chunk, duration, end, position] = transfers_[transfer];
+
+    // wait for the previous transfer of the link, and for the chunk to arrive at src
+    auto start = Time(0);
+    if (position > 0) {
+        start = transfers_[links_[src][dest][position - 1]].end;
+    }
+    const auto deliverer = deliverers_[chunk][src];
+    if (deliverer >= 0) {
+        start = std::max(start, transfers_[deliverer].end);
+    }
+    return start;
+}
+
+bool LocalSearch::retime_(const std::vector<int>& seeds, const Time limit) noexcept {
+    auto queue = std::deque<int>(seeds.begin(), seeds.end());
+    while (!queue.empty()) {
+        const auto transfer = queue.front();
+        queue.pop_front();
+
+        auto& current = transfers_[transfer];
+        const auto end = start_(transfer) + current.duration;
+        if (isEqual(end, current.end)) {
+            continue;
+        }
+        undoLog_.emplace_back(transfer, current.end);
+        current.end = end;
+
+        // a cyclic move delays its transfers forever: it is abandoned here as well
+        if (end > limit && !isEqual(end, limit)) {
+            return false;
+        }
+
+        // the next transfer of the link, and the transfers forwarding the chunk
+        const auto& link = links_[current.src][current.dest];
+        if (current.position + 1 < static_cast<int>(link.size())) {
+            queue.push_back(link[current.position + 1]);
+        }
+        for (const auto sender : senders_[current.chunk][current.dest]) {
+            queue.push_back(sender);
+        }
+    }
+    return true;
+}
+
+void LocalSearch::undo_() noexcept {
+    for (auto it = undoLog_.rbegin(); it != undoLog_.rend(); it++) {
+        transfers_[it->first].end = it->second;
+    }
+    undoLog_.clear();
+}
+
+std::pair<LocalSearch::Time, int> LocalSearch::makespan_() const noexcept {
+    auto makespan = Time(0);
+    auto criticalCount = 0;
+    for (const auto& transfer : transfers_) {
+        if (isEqual(transfer.end, makespan)) {
+            criticalCount++;
+        } else if (transfer.end > makespan) {
+            makespan = transfer.end;
+            criticalCount = 1;
+        }
+    }
+    return {makespan, criticalCount};
+}
+
+int LocalSearch::criticalTransfer_(const Time makespan) noexcept {
+    // start from a transfer arriving at the collective time
+    auto critical = std::vector<int>();
+    for (auto transfer = 0; transfer < static_cast<int>(transfers_.size()); transfer++) {
+        if (isEqual(transfers_[transfer].end, makespan)) {
+            critical.push_back(transfer);
+        }
+    }
+    assert(!critical.empty());
+    auto dist = std::uniform_int_distribution<>(0, critical.size() - 1);
+    auto transfer = critical[dist(randomEngine_)];
+
+    // then, walk back the predecessors that bind the start of each transfer
+    auto path = std::vector<int>{transfer};
+    while (true) {
+        const auto& [src, dest, chunk, duration, end, position] = transfers_[transfer];
+        const auto start = end - duration;
+        auto binding = std::vector<int>();
+        if (position > 0) {
+            const auto previous = links_[src][dest][position - 1];
+            if (isEqual(transfers_[previous].end, start)) {
+                binding.push_back(previous);
+            }
+        }
+        const auto deliverer = deliverers_[chunk][src];
+        if (deliverer >= 0 && isEqual(transfers_[deliverer].end, start)) {
+            binding.push_back(deliverer);
+        }
+        if (binding.empty()) {
+            break;
+        }
+        auto bindingDist = std::uniform_int_distribution<>(0, binding.size() - 1);
+        transfer = binding[bindingDist(randomEngine_)];
+        path.push_back(transfer);
+    }
+
+    auto pathDist = std::uniform_int_distribution<>(0, path.size() - 1);
+    return path[pathDist(randomEngine_)];
+}
+
+std::vector<int> LocalSearch::move_(const int transfer,
+                                    const NpuID src,
+                                    const int position) noexcept {
+    auto& current = transfers_[transfer];
+    const auto dest = current.dest;
+    const auto chunk = current.chunk;
+    auto seeds = std::vector<int>();
+
+    // remove the transfer from its link
+    auto& oldLink = links_[current.src][dest];
+    oldLink.erase(oldLink.begin() + current.position);
+    for (auto i = current.position; i < static_cast<int>(oldLink.size()); i++) {
+        transfers_[oldLink[i]].position = i;
+    }
+    if (current.position < static_cast<int>(oldLink.size())) {
+        seeds.push_back(oldLink[current.position]);
+    }
+    auto& oldSenders = senders_[chunk][current.src];
+    oldSenders.erase(std::find(oldSenders.begin(), oldSenders.end(), transfer));
+
+    // then, insert it into the new link
+    current.src = src;
+    current.duration = linkTimes_[src][dest];
+    assert(current.duration >= 0);
+    auto& newLink = links_[src][dest];
+    assert(0 <= position && position <= static_cast<int>(newLink.size()));
+    newLink.insert(newLink.begin() + position, transfer);
+    for (auto i = position; i < static_cast<int>(newLink.size()); i++) {
+        transfers_[newLink[i]].position = i;
+    }
+    senders_[chunk][src].push_back(transfer);
+
+    seeds.push_back(transfer);
+    if (position + 1 < static_cast<int>(newLink.size())) {
+        seeds.push_back(newLink[position + 1]);
+    }
+    return seeds;
+}
+
+SynthesisResult LocalSearch::result_(const Topology& topology,
+                                     const Collective& collective) const noexcept {
+    // record the transfers in their order of arrival,
+    // so that every chunk arrives at a source before it is sent
+    auto order = std::vector<int>(transfers_.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](const int lhs, const int rhs) {
+        return transfers_[lhs].end < transfers_[rhs].end;
+    });
+
+    auto synthesisResult = SynthesisResult(topology, collective);
+    auto collectiveTime = Time(0);
+    for (const auto transfer : order) {
+        const auto& [src, dest, chunk, duration, end, position] = transfers_[transfer];
+        synthesisResult.npu(src).linkTo(dest).send(chunk, end);
+        synthesisResult.npu(dest).linkFrom(src).recv(chunk, end);
+        collectiveTime = std::max(collectiveTime, end);
+    }
+    synthesisResult.collectiveTime(collectiveTime);
+    return synthesisResult;
+}
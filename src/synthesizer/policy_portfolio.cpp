@@ -0,0 +1,81 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <tacos/synthesizer/policy_portfolio.h>
+
+using namespace tacos;
+
+PolicyPortfolio::PolicyPortfolio() noexcept = default;
+
+PolicyPortfolio PolicyPortfolio::builtIn() noexcept {
+    auto portfolio = PolicyPortfolio();
+    for (const auto policy :
+         {Synthesizer::MatchingPolicy::Random, Synthesizer::MatchingPolicy::Greedy,
+          Synthesizer::MatchingPolicy::Lookahead}) {
+        portfolio.add([policy](Synthesizer& synthesizer) { synthesizer.matchingPolicy(policy); });
+    }
+    return portfolio;
+}
+
+int PolicyPortfolio::add(Configuration configuration) noexcept {
+    assert(configuration != nullptr);
+
+    configurations_.push_back(std::move(configuration));
+    return static_cast<int>(configurations_.size()) - 1;
+}
+
+std::optional<PolicyPortfolio::Result> PolicyPortfolio::race(const Topology& topology,
+                                                             const Collective& collective,
+                                                             const ChunkSize chunkSize,
+                                                             const double budget) const noexcept {
+    assert(!configurations_.empty());
+    assert(chunkSize > 0);
+    assert(budget > 0);
+
+    // start every configuration on its own synthesizer and thread
+    const auto configurationsCount = static_cast<int>(configurations_.size());
+    auto synthesizers = std::vector<std::unique_ptr<Synthesizer>>();
+    auto futures = std::vector<std::future<std::optional<SynthesisResult>>>();
+    auto cancellationToken = CancellationToken();
+    for (const auto& configuration : configurations_) {
+        auto synthesizer = std::make_unique<Synthesizer>();
+        configuration(*synthesizer);
+        futures.push_back(
+            synthesizer->solveAsync(topology, collective, chunkSize, cancellationToken));
+        synthesizers.push_back(std::move(synthesizer));
+    }
+
+    // wait until the deadline, then cancel the syntheses still running
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                              std::chrono::duration<double, std::milli>(budget));
+    for (auto& future : futures) {
+        if (future.wait_until(deadline) != std::future_status::ready) {
+            cancellationToken.cancel();
+            break;
+        }
+    }
+
+    // keep the shortest collective time (the lowest index on ties)
+    auto best = std::optional<Result>();
+    for (auto i = 0; i < configurationsCount; i++) {
+        auto synthesisResult = futures[i].get();
+        if (!synthesisResult.has_value()) {
+            continue;
+        }
+        if (!best.has_value() ||
+            synthesisResult->collectiveTime() < best->synthesisResult.collectiveTime()) {
+            best.emplace(Result{i, std::move(synthesisResult.value())});
+        }
+    }
+
+    return best;
+}
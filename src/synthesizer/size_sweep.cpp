@@ -0,0 +1,42 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cassert>
+#include <tacos/synthesizer/size_sweep.h>
+
+using namespace tacos;
+
+SizeSweep::SizeSweep(const ChunkSize minBytes, const ChunkSize maxBytes, const int factor) noexcept
+    : minBytes_(minBytes), maxBytes_(maxBytes), factor_(factor) {
+    assert(minBytes > 0);
+    assert(maxBytes >= minBytes);
+    assert(factor > 1);
+}
+
+std::vector<SizeSweep::Range> SizeSweep::solve(const Topology& topology,
+                                               const Collective& collective) noexcept {
+    const auto chunksCount = collective.chunksCount();
+    assert(minBytes_ >= chunksCount);
+
+    auto ranges = std::vector<Range>();
+    for (auto bufferSize = minBytes_; bufferSize <= maxBytes_; bufferSize *= factor_) {
+        // the same seed makes sizes with the same event order yield the same schedule
+        synthesizer_.seed(seed_);
+        const auto chunkSize = bufferSize / chunksCount;
+        auto result = synthesizer_.solve(topology, collective, chunkSize);
+
+        // extend the last range if the schedule did not change
+        if (!ranges.empty() && ranges.back().result.sameSchedule(result)) {
+            ranges.back().maxBytes = bufferSize * factor_;
+            continue;
+        }
+        ranges.push_back({bufferSize, bufferSize * factor_, std::move(result)});
+    }
+
+    return ranges;
+}
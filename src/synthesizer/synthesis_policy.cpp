@@ -0,0 +1,41 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cassert>
+#include <tacos/synthesizer/synthesis_policy.h>
+
+using namespace tacos;
+
+SynthesisPolicy::~SynthesisPolicy() noexcept = default;
+
+void SynthesisPolicy::orderPostconditions(const State& /*state*/,
+                                          std::vector<Condition>& /*postcondition*/) noexcept {
+    // keep the shuffled order
+}
+
+SynthesisPolicy::NpuID SynthesisPolicy::selectSource(
+    const State& state,
+    const ChunkID /*chunk*/,
+    const NpuID /*dest*/,
+    const std::vector<NpuID>& candidates) noexcept {
+    assert(!candidates.empty());
+
+    auto dist = std::uniform_int_distribution<>(0, candidates.size() - 1);
+    return candidates[dist(state.randomEngine)];
+}
+
+SynthesisPolicy::ChunkID SynthesisPolicy::selectReplacement(
+    const State& state,
+    const NpuID /*src*/,
+    const NpuID /*dest*/,
+    const std::vector<ChunkID>& candidates) noexcept {
+    assert(!candidates.empty());
+
+    auto dist = std::uniform_int_distribution<>(0, candidates.size() - 1);
+    return candidates[dist(state.randomEngine)];
+}
@@ -9,6 +9,7 @@ Copyright (c) 2022-2025 Georgia Institute of Technology
 #include <cassert>
 #include <limits>
 #include <tacos/synthesizer/synthesizer.h>
+#include <tacos/synthesizer/time_reversal.h>
 
 using namespace tacos;
 
@@ -22,41 +23,144 @@ SynthesisResult Synthesizer::solve(const Topology& topology,
     // initialize the synthesizer
     initialize_(topology, collective, chunkSize);
 
+    // run the synthesis (neither cancellable nor reported)
+    auto synthesisResult = synthesize_(nullptr, nullptr, 1);
+    assert(synthesisResult.has_value());
+    return reverse_(std::move(synthesisResult.value()), chunkSize);
+}
+
+void Synthesizer::matchingPolicy(const MatchingPolicy policy) noexcept {
+    matchingPolicy_ = policy;
+}
+
+void Synthesizer::orderingPolicy(const OrderingPolicy policy) noexcept {
+    orderingPolicy_ = policy;
+}
+
+void Synthesizer::replacementPolicy(const ReplacementPolicy policy) noexcept {
+    replacementPolicy_ = policy;
+}
+
+void Synthesizer::speculativeRelay(const int maxInFlight) noexcept {
+    assert(maxInFlight >= 0);
+    maxSpeculativeTransfers_ = maxInFlight;
+}
+
+void Synthesizer::policy(std::shared_ptr<SynthesisPolicy> policy) noexcept {
+    policy_ = std::move(policy);
+}
+
+void Synthesizer::beamSearch(const int beamWidth, const int branchingFactor) noexcept {
+    assert(beamWidth >= 0);
+    assert(branchingFactor > 0);
+    beamWidth_ = beamWidth;
+    branchingFactor_ = branchingFactor;
+}
+
+void Synthesizer::reductionCost(const Topology::Bandwidth bandwidth,
+                                const Topology::Latency latency) noexcept {
+    assert(bandwidth >= 0);
+    assert(latency >= 0);
+    reductionBandwidth_ = bandwidth;
+    reductionLatency_ = latency;
+}
+
+Synthesizer::Time Synthesizer::reductionTime(const ChunkSize chunkSize) const noexcept {
+    // alpha-beta model of the reduction of a partial chunk
+    auto reductionTime = reductionLatency_;
+    if (reductionBandwidth_ > 0) {
+        const auto bandwidthConverted = reductionBandwidth_ * (1 << 30) / 1e6;  // bytes/us
+        reductionTime += chunkSize / bandwidthConverted;
+    }
+    return reductionTime;
+}
+
+void Synthesizer::linksBusyUntil(std::vector<std::vector<Time>> linksBusyUntil) noexcept {
+    linksBusyUntil_ = std::move(linksBusyUntil);
+}
+
+void Synthesizer::issueTime(const Time issueTime) noexcept {
+    assert(issueTime >= 0);
+    issueTime_ = issueTime;
+}
+
+void Synthesizer::seed(const std::mt19937::result_type seed) noexcept {
+    randomEngine.seed(seed);
+}
+
+std::future<std::optional<SynthesisResult>> Synthesizer::solveAsync(
+    const Topology& topology,
+    const Collective& collective,
+    const ChunkSize chunkSize,
+    CancellationToken cancellationToken,
+    ProgressCallback progressCallback,
+    const int progressInterval) noexcept {
+    assert(chunkSize > 0);
+    assert(progressInterval > 0);
+
+    // run initialization and synthesis on a separate thread
+    auto task = [this, &topology, &collective, chunkSize, progressInterval,
+                 cancellationToken = std::move(cancellationToken),
+                 progressCallback = std::move(progressCallback)]() {
+        initialize_(topology, collective, chunkSize);
+        const auto* const callback = progressCallback ? &progressCallback : nullptr;
+        auto synthesisResult = synthesize_(&cancellationToken, callback, progressInterval);
+        if (synthesisResult.has_value()) {
+            synthesisResult = reverse_(std::move(synthesisResult.value()), chunkSize);
+        }
+        return synthesisResult;
+    };
+    return std::async(std::launch::async, std::move(task));
+}
+
+SynthesisResult Synthesizer::reverse_(SynthesisResult synthesisResult,
+                                      const ChunkSize chunkSize) const noexcept {
+    if (!collective_->reduction()) {
+        return synthesisResult;
+    }
+
+    return TimeReversal::reverse(*topology_, *collective_, chunkSize, synthesisResult,
+                                 reductionTime(chunkSize), linksBusyUntil_, issueTime_);
+}
+
+std::optional<SynthesisResult> Synthesizer::synthesize_(
+    const CancellationToken* const cancellationToken,
+    const ProgressCallback* const progressCallback,
+    const int progressInterval) noexcept {
     // mark trivial initial case
     // that is, chunks in preconditions are already at their sources
     markPrecondition_();
 
+    // the beam search explores several partial schedules instead of a single one
+    if (beamWidth_ > 0) {
+        return beamSynthesize_(cancellationToken, progressCallback, progressInterval);
+    }
+
+    // number of events processed so far (for progress reports)
+    auto eventsProcessed = 0;
+
     // then, repeat the link-chunk matching process
     while (!eventQueue_.empty()) {
-        // get current event time
-        currentTime_ = eventQueue_.pop();
-
-        // first, filter out unsatisfied postconditions
-        // this is required when choosing the chunk replacement candidates
-        // during the expansion of the TEN
-        auto postconditionMap = filterPostcondition_();
-
-        // then, expand the TEN
-        // this method will also process and update the arrival of chunks
-        // at the current timestep, and will change the unsatisfied postconditions
-        expandTenTimestep_(&postconditionMap);
-
-        // after the expansion of the TEN, check if there are any unsatisfied postconditions
-        auto postcondition = shufflePostcondition_(postconditionMap);
-
-        if (postcondition.empty()) {
-            // no unsatisfied postcondition left to map
-            // if so, just proceed to the next event
-            // until all chunks arrive at their destinations
-            continue;
+        // abort if the caller requested cancellation
+        if (cancellationToken != nullptr && cancellationToken->cancelled()) {
+            return std::nullopt;
         }
 
-        // for all unsatisfied postconditions, run link-chunk matching
-        for (const auto [chunk, dest] : postcondition) {
-            linkChunkMatching_(chunk, dest);
+        // process the next event
+        const auto postconditionMap = step_();
+        eventsProcessed++;
+
+        // periodically report the progress
+        if (progressCallback != nullptr && eventsProcessed % progressInterval == 0) {
+            reportProgress_(*progressCallback, postconditionMap, eventsProcessed);
         }
     }
 
+    // report the final progress
+    if (progressCallback != nullptr) {
+        reportProgress_(*progressCallback, PostconditionMap(), eventsProcessed);
+    }
+
     // all matching has been finished
     // set collective time and return synthesis result
     assert(collectiveTime_ > 0);
@@ -64,12 +168,348 @@ SynthesisResult Synthesizer::solve(const Topology& topology,
     return std::move(*synthesisResult_);
 }
 
+Synthesizer::PostconditionMap Synthesizer::step_() noexcept {
+    // get current event time, by which some chunks may have been released
+    currentTime_ = eventQueue_.pop();
+    releaseChunks_();
+
+    // first, filter out unsatisfied postconditions
+    // this is required when choosing the chunk replacement candidates
+    // during the expansion of the TEN
+    auto postconditionMap = filterPostcondition_();
+
+    // then, expand the TEN
+    // this method will also process and update the arrival of chunks
+    // at the current timestep, and will change the unsatisfied postconditions
+    expandTenTimestep_(&postconditionMap);
+
+    // after the expansion of the TEN, check if there are any unsatisfied postconditions
+    auto postcondition = shufflePostcondition_(postconditionMap);
+
+    // the chunks with earlier deadlines claim links first
+    if (prioritized_) {
+        std::stable_sort(postcondition.begin(), postcondition.end(),
+                         [this](const Condition& lhs, const Condition& rhs) {
+                             return collective_->deadline(lhs.first) <
+                                    collective_->deadline(rhs.first);
+                         });
+    }
+
+    if (postcondition.empty()) {
+        // no unsatisfied postcondition left to map
+        // if so, just proceed to the next event
+        // until all chunks arrive at their destinations
+        return postconditionMap;
+    }
+
+    // for all unsatisfied postconditions, run link-chunk matching
+    for (const auto [chunk, dest] : postcondition) {
+        linkChunkMatching_(chunk, dest, postconditionMap);
+    }
+
+    // then, forward the chunks that cannot reach their destinations otherwise
+    if (relayed_) {
+        relayChunks_(postcondition);
+    }
+
+    // then, put the links left idle to use by relaying chunks speculatively
+    if (maxSpeculativeTransfers_ > 0) {
+        relayIdleLinks_(postconditionMap);
+    }
+
+    return postconditionMap;
+}
+
+std::optional<SynthesisResult> Synthesizer::beamSynthesize_(
+    const CancellationToken* const cancellationToken,
+    const ProgressCallback* const progressCallback,
+    const int progressInterval) noexcept {
+    // a partial schedule of the beam, with its score
+    struct Partial {
+        Snapshot snapshot;
+        Time bound;
+        Time totalArrival;
+    };
+
+    // two expansions of the same partial schedule are the same
+    // if they made the same transfers and occupy the same links
+    auto sameExpansion = [this](const Snapshot& lhs, const Snapshot& rhs) {
+        const auto& lhsTransfers = lhs.transferLog->transfers;
+        const auto& rhsTransfers = rhs.transferLog->transfers;
+        const auto sameTransfer = [](const Transfer& lhs, const Transfer& rhs) {
+            return lhs.src == rhs.src && lhs.dest == rhs.dest && lhs.chunk == rhs.chunk;
+        };
+        if (!std::equal(lhsTransfers.begin(), lhsTransfers.end(), rhsTransfers.begin(),
+                        rhsTransfers.end(), sameTransfer)) {
+            return false;
+        }
+        for (auto src = 0; src < npusCount; src++) {
+            for (auto dest = 0; dest < npusCount; dest++) {
+                if (lhs.ten.chunk(src, dest) != rhs.ten.chunk(src, dest)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    transferLog_ = std::make_shared<TransferLog>();
+    auto beam = std::vector<Partial>();
+    beam.push_back({snapshot_(), 0, 0});
+    auto best = std::optional<Snapshot>();
+    auto eventsProcessed = 0;
+
+    while (!beam.empty()) {
+        // abort if the caller requested cancellation
+        if (cancellationToken != nullptr && cancellationToken->cancelled()) {
+            transferLog_ = nullptr;
+            return std::nullopt;
+        }
+
+        // complete schedules compete for the best one,
+        // while the others move on to the earliest of their next events
+        auto horizon = std::numeric_limits<Time>::max();
+        auto incomplete = std::vector<Partial>();
+        for (auto& partial : beam) {
+            if (partial.snapshot.eventQueue.empty()) {
+                if (!best.has_value() || partial.snapshot.collectiveTime < best->collectiveTime) {
+                    best.emplace(std::move(partial.snapshot));
+                }
+                continue;
+            }
+            horizon = std::min(horizon, partial.snapshot.eventQueue.peek());
+            incomplete.push_back(std::move(partial));
+        }
+
+        // expand the partial schedules with an event at the horizon,
+        // so that all partial schedules are compared at the same time
+        auto expansions = std::vector<Partial>();
+        for (auto& partial : incomplete) {
+            if (partial.snapshot.eventQueue.peek() > horizon) {
+                expansions.push_back(std::move(partial));
+                continue;
+            }
+
+            const auto siblings = static_cast<int>(expansions.size());
+            for (auto i = 0; i < branchingFactor_; i++) {
+                restore_(partial.snapshot);
+                const auto postconditionMap = step_();
+                auto snapshot = snapshot_();
+
+                // random choices may lead to the same expansion more than once
+                const auto duplicate = std::any_of(
+                    expansions.begin() + siblings, expansions.end(),
+                    [&](const Partial& sibling) {
+                        return sameExpansion(sibling.snapshot, snapshot);
+                    });
+                if (duplicate) {
+                    continue;
+                }
+
+                auto totalArrival = Time(0);
+                const auto bound = bound_(postconditionMap, &totalArrival);
+                expansions.push_back({std::move(snapshot), bound, totalArrival});
+            }
+        }
+        eventsProcessed++;
+
+        // keep the most promising expansions that may still beat the best complete schedule
+        auto order = std::vector<int>(expansions.size());
+        for (auto i = 0; i < static_cast<int>(order.size()); i++) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&](const int lhs, const int rhs) {
+            const auto& lhsPartial = expansions[lhs];
+            const auto& rhsPartial = expansions[rhs];
+            if (!isEqual(lhsPartial.bound, rhsPartial.bound)) {
+                return lhsPartial.bound < rhsPartial.bound;
+            }
+            return lhsPartial.totalArrival < rhsPartial.totalArrival;
+        });
+
+        beam.clear();
+        for (const auto i : order) {
+            if (static_cast<int>(beam.size()) >= beamWidth_) {
+                break;
+            }
+            if (best.has_value() && expansions[i].bound >= best->collectiveTime) {
+                continue;
+            }
+            beam.push_back(std::move(expansions[i]));
+        }
+
+        // periodically report the progress of the most promising partial schedule
+        if (progressCallback != nullptr && eventsProcessed % progressInterval == 0 &&
+            !beam.empty()) {
+            restore_(beam.front().snapshot);
+            reportProgress_(*progressCallback, filterPostcondition_(), eventsProcessed);
+        }
+    }
+
+    // restore the best schedule, and replay its transfers into the synthesis result
+    assert(best.has_value());
+    restore_(best.value());
+    transferLog_ = nullptr;
+
+    auto logs = std::vector<const TransferLog*>();
+    for (const auto* log = best->transferLog.get(); log != nullptr; log = log->previous.get()) {
+        logs.push_back(log);
+    }
+    for (auto it = logs.rbegin(); it != logs.rend(); it++) {
+        for (const auto& transfer : (*it)->transfers) {
+            const auto [src, dest, chunk, time] = transfer;
+            synthesisResult_->npu(src).linkTo(dest).send(chunk, time);
+            synthesisResult_->npu(dest).linkFrom(src).recv(chunk, time);
+        }
+    }
+
+    // report the final progress
+    if (progressCallback != nullptr) {
+        reportProgress_(*progressCallback, PostconditionMap(), eventsProcessed);
+    }
+
+    assert(collectiveTime_ > 0);
+    synthesisResult_->collectiveTime(collectiveTime_);
+    return std::move(*synthesisResult_);
+}
+
+Synthesizer::Snapshot Synthesizer::snapshot_() const noexcept {
+    return {eventQueue_,           *ten_,          chunkMap_,    replicas_,       speculative_,
+            speculativeTransfers_, releasedCount_, currentTime_, collectiveTime_, transferLog_};
+}
+
+void Synthesizer::restore_(const Snapshot& snapshot) noexcept {
+    eventQueue_ = snapshot.eventQueue;
+    ten_ = std::make_unique<TimeExpandedNetwork>(snapshot.ten);
+    chunkMap_ = snapshot.chunkMap;
+    replicas_ = snapshot.replicas;
+    speculative_ = snapshot.speculative;
+    speculativeTransfers_ = snapshot.speculativeTransfers;
+    releasedCount_ = snapshot.releasedCount;
+    currentTime_ = snapshot.currentTime;
+    collectiveTime_ = snapshot.collectiveTime;
+
+    // the transfers of the next event extend (and share) the restored ones
+    transferLog_ = std::make_shared<TransferLog>(TransferLog{snapshot.transferLog, {}});
+}
+
+Synthesizer::Time Synthesizer::bound_(const PostconditionMap& postconditionMap,
+                                      Time* const totalArrival) const noexcept {
+    // links busy with a transfer in flight
+    auto busyLinks = std::vector<std::pair<NpuID, NpuID>>();
+    for (auto src = 0; src < npusCount; src++) {
+        for (auto dest = 0; dest < npusCount; dest++) {
+            if (ten_->busyUntil(src, dest) >= 0 && ten_->chunk(src, dest) >= 0) {
+                busyLinks.emplace_back(src, dest);
+            }
+        }
+    }
+
+    // unsatisfied destination NPUs of every pending chunk
+    auto pendingDests = std::unordered_map<ChunkID, std::vector<NpuID>>();
+    for (const auto& [dest, chunks] : postconditionMap) {
+        for (const auto chunk : chunks) {
+            pendingDests[chunk].push_back(dest);
+        }
+    }
+
+    auto bound = std::max(collectiveTime_, Time(0));
+    *totalArrival = 0;
+    auto starts = std::vector<Time>(npusCount);
+    for (const auto& [chunk, dests] : pendingDests) {
+        // earliest time the chunk can leave every NPU: now from its holders,
+        // or when a transfer in flight from a holder ends (a replacement may carry it)
+        std::fill(starts.begin(), starts.end(), std::numeric_limits<Time>::max());
+        for (auto npu = 0; npu < npusCount; npu++) {
+            if (chunkMap_[chunk][npu]) {
+                starts[npu] = currentTime_;
+            }
+        }
+        const auto source = collective_->precondition(chunk);
+        if (!chunkMap_[chunk][source]) {
+            // not released yet
+            starts[source] = releaseTime_(chunk);
+            for (const auto replica : collective_->replicas(chunk)) {
+                starts[replica] = starts[source];
+            }
+        }
+        for (const auto& [src, dest] : busyLinks) {
+            if (chunkMap_[chunk][src]) {
+                starts[dest] = std::min(starts[dest], ten_->busyUntil(src, dest));
+            }
+        }
+
+        // then, the chunk follows a shortest path to each of its destinations
+        for (const auto dest : dests) {
+            auto earliest = std::numeric_limits<Time>::max();
+            for (auto npu = 0; npu < npusCount; npu++) {
+                if (starts[npu] < std::numeric_limits<Time>::max()) {
+                    earliest = std::min(earliest, starts[npu] + pathTimes_[npu][dest]);
+                }
+            }
+            bound = std::max(bound, earliest);
+            *totalArrival += earliest;
+        }
+    }
+    return bound;
+}
+
+void Synthesizer::recordTransfer_(const NpuID src, const NpuID dest, const ChunkID chunk) noexcept {
+    // the beam search replays the transfers of the best schedule only
+    if (transferLog_ != nullptr) {
+        transferLog_->transfers.push_back({src, dest, chunk, currentTime_});
+        return;
+    }
+
+    synthesisResult_->npu(src).linkTo(dest).send(chunk, currentTime_);
+    synthesisResult_->npu(dest).linkFrom(src).recv(chunk, currentTime_);
+}
+
+void Synthesizer::reportProgress_(const ProgressCallback& progressCallback,
+                                  const PostconditionMap& postconditionMap,
+                                  const int eventsProcessed) const noexcept {
+    // count the remaining postconditions
+    auto remainingPostconditions = 0;
+    for (const auto& [dest, chunks] : postconditionMap) {
+        remainingPostconditions += static_cast<int>(chunks.size());
+    }
+
+    const auto progress = Progress{currentTime_, postconditionsCount_ - remainingPostconditions,
+                                   remainingPostconditions, eventsProcessed};
+    progressCallback(progress);
+}
+
 void Synthesizer::initialize_(const Topology& topology,
                               const Collective& collective,
                               const ChunkSize chunkSize) noexcept {
     // reset the event queue
     eventQueue_.reset();
     currentTime_ = 0;
+    collectiveTime_ = -1;
+
+    // construct TEN from the topology,
+    // or only recompute its link times when synthesizing over the same topology again
+    if (ten_ != nullptr && topology_ == &topology && tenGeneration_ == topology.generation()) {
+        ten_->reset(chunkSize);
+    } else {
+        ten_ = std::make_unique<TimeExpandedNetwork>(topology, chunkSize);
+        tenGeneration_ = topology.generation();
+    }
+
+    // links still busy before the synthesis free up at their own events
+    // (the schedule of a reduction is only re-timed around them once reversed)
+    if (!linksBusyUntil_.empty() && !collective.reduction()) {
+        assert(static_cast<int>(linksBusyUntil_.size()) == topology.npusCount());
+        for (auto src = 0; src < topology.npusCount(); src++) {
+            for (auto dest = 0; dest < topology.npusCount(); dest++) {
+                const auto busyUntil = linksBusyUntil_[src][dest];
+                if (busyUntil > 0 && topology.connected(src, dest)) {
+                    ten_->occupy(src, dest, busyUntil);
+                    eventQueue_.schedule(busyUntil);
+                }
+            }
+        }
+    }
 
     // set topology and collective
     topology_ = &topology;
@@ -79,21 +519,96 @@ void Synthesizer::initialize_(const Topology& topology,
     npusCount = topology_->npusCount();
     chunksCount_ = collective_->chunksCount();
 
-    // construct TEN from the topology
-    ten_ = std::make_unique<TimeExpandedNetwork>(*topology_, chunkSize);
+    // count the (chunk, dest) postconditions
+    postconditionsCount_ = 0;
+    for (auto chunk = 0; chunk < chunksCount_; ++chunk) {
+        postconditionsCount_ += static_cast<int>(collective_->postcondition(chunk).size());
+    }
+
+    // non-random policies weigh chunks by their remaining distance
+    const auto distancePriority = (orderingPolicy_ == OrderingPolicy::DistancePriority);
+    const auto speculativeRelay = (maxSpeculativeTransfers_ > 0);
+    const auto customPolicy = (policy_ != nullptr);
+    const auto nonRandomMatching = (matchingPolicy_ != MatchingPolicy::Random);
+    if (nonRandomMatching || distancePriority || speculativeRelay || customPolicy) {
+        hops_ = topology_->hopDistances();
+    }
+    if (distancePriority) {
+        pathLatencies_ = topology_->pathLatencies();
+    }
+
+    // reductions follow the order of their dual schedule
+    prioritized_ = collective.prioritized() && !collective.reduction();
+
+    // chunks not needed by every NPU may have to be relayed through the others
+    relayed_ = false;
+    for (auto chunk = 0; chunk < chunksCount_ && !relayed_; ++chunk) {
+        const auto& dests = collective_->postcondition(chunk);
+        auto covered = static_cast<int>(dests.size());
+        covered += (dests.count(collective_->precondition(chunk)) == 0 ? 1 : 0);
+        for (const auto replica : collective_->replicas(chunk)) {
+            covered += (dests.count(replica) == 0 ? 1 : 0);
+        }
+        relayed_ = (covered < npusCount);
+    }
+
+    // the beam search bounds the collective time with shortest-path times,
+    // along which the relayed chunks are forwarded
+    if (beamWidth_ > 0 || relayed_) {
+        pathTimes_ = ten_->shortestPathTimes();
+    }
 
     // construct chunkMap_
     chunkMap_.assign(chunksCount_, std::vector<bool>(npusCount, false));
+    replicas_.assign(chunksCount_, 0);
+
+    // no speculative transfer is in flight yet
+    speculative_.assign(npusCount, std::vector<bool>(npusCount, false));
+    speculativeTransfers_ = 0;
 
     // construct synthesis result for XML generation
     synthesisResult_ = std::make_unique<SynthesisResult>(*topology_, *collective_);
 }
 
 void Synthesizer::markPrecondition_() noexcept {
-    // for every chunk, mark its source NPU as true in the chunkMap_
+    // for every chunk, mark its source NPU (and replicas) as true in the chunkMap_,
+    // or schedule its release
+    releaseOrder_.clear();
+    releasedCount_ = 0;
     for (auto chunk = 0; chunk < chunksCount_; ++chunk) {
-        const auto src = collective_->precondition(chunk);
-        chunkMap_[chunk][src] = true;
+        const auto releaseTime = releaseTime_(chunk);
+        if (releaseTime > 0 && !collective_->reduction()) {
+            releaseOrder_.push_back(chunk);
+            eventQueue_.schedule(releaseTime);
+        } else {
+            markSources_(chunk);
+        }
+    }
+    std::stable_sort(releaseOrder_.begin(), releaseOrder_.end(),
+                     [this](const ChunkID lhs, const ChunkID rhs) {
+                         return releaseTime_(lhs) < releaseTime_(rhs);
+                     });
+}
+
+void Synthesizer::releaseChunks_() noexcept {
+    const auto releasesCount = static_cast<int>(releaseOrder_.size());
+    while (releasedCount_ < releasesCount) {
+        const auto chunk = releaseOrder_[releasedCount_];
+        if (releaseTime_(chunk) > currentTime_) {
+            break;
+        }
+        markSources_(chunk);
+        releasedCount_++;
+    }
+}
+
+void Synthesizer::markSources_(const ChunkID chunk) noexcept {
+    const auto src = collective_->precondition(chunk);
+    chunkMap_[chunk][src] = true;
+    replicas_[chunk]++;
+    for (const auto replica : collective_->replicas(chunk)) {
+        chunkMap_[chunk][replica] = true;
+        replicas_[chunk]++;
     }
 }
 
@@ -127,6 +642,42 @@ std::vector<Synthesizer::Condition> Synthesizer::shufflePostcondition_(
 
     // shuffle the postcondition vector
     std::shuffle(postcondition.begin(), postcondition.end(), randomEngine);
+    if (policy_ != nullptr) {
+        policy_->orderPostconditions(state_(), postcondition);
+        return postcondition;
+    }
+    if (orderingPolicy_ != OrderingPolicy::DistancePriority) {
+        return postcondition;
+    }
+
+    // serve the long-haul chunks first: a chunk is as far as its farthest unsatisfied dest
+    // from the nearest current holder, by hops and then by path latency
+    // (the shuffle above breaks the remaining ties)
+    using Distance = std::pair<int, Topology::Latency>;
+    auto chunkDistances = std::unordered_map<ChunkID, Distance>();
+    for (const auto& [chunk, dest] : postcondition) {
+        auto nearest = Distance(std::numeric_limits<int>::max(), 0);
+        for (auto npu = 0; npu < npusCount; npu++) {
+            if (chunkMap_[chunk][npu] && hops_[npu][dest] >= 0) {
+                nearest = std::min(nearest, Distance(hops_[npu][dest], pathLatencies_[npu][dest]));
+            }
+        }
+        auto& distance = chunkDistances[chunk];
+        distance = std::max(distance, nearest);
+    }
+
+    auto distances = std::vector<std::pair<Distance, Condition>>();
+    distances.reserve(postcondition.size());
+    for (const auto& condition : postcondition) {
+        distances.emplace_back(chunkDistances.at(condition.first), condition);
+    }
+    std::stable_sort(distances.begin(), distances.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first > rhs.first;
+    });
+
+    for (auto i = 0; i < static_cast<int>(distances.size()); i++) {
+        postcondition[i] = distances[i].second;
+    }
     return postcondition;
 }
 
@@ -163,10 +714,20 @@ void Synthesizer::expandTenTimestep_(PostconditionMap* const postconditionMap) n
             // for case 2, check if the chunk has already arrived at dest
             // by following other paths
             // and if so, check if we can replace this path with another chun
-            if (chunkMap_[chunk][dest]) {
+            auto redundant = chunkMap_[chunk][dest];
+
+            // a speculative relay is also useless if all destinations got the chunk meanwhile
+            if (speculative_[src][dest]) {
+                speculative_[src][dest] = false;
+                speculativeTransfers_--;
+                redundant = redundant || !pending_(chunk);
+            }
+
+            if (redundant) {
                 // dest has already received this chunk
                 // so check the replacement candidates
-                const auto replacementChunk = findReplacementChunk_(src, dest, postconditionMap);
+                const auto replacementChunk =
+                    findReplacementChunk_(src, dest, chunk, postconditionMap);
 
                 if (!replacementChunk.has_value()) {
                     // no replacement candidate found
@@ -180,15 +741,18 @@ void Synthesizer::expandTenTimestep_(PostconditionMap* const postconditionMap) n
             }
 
             // a meaningful chunk (regardless of replacement) has arrived at dest
-            eventHappened = true;
+            // (a relayed chunk only counts once it reaches a destination)
+            if (!relayed_ || collective_->postcondition(chunk).count(dest) > 0) {
+                eventHappened = true;
+            }
 
             // mark the chunk arrived at dest, and mark this TEN link as available
             chunkMap_[chunk][dest] = true;
+            replicas_[chunk]++;
             ten_->transferFinished(src, dest);
 
             // record the send and recv operations for XML generation
-            synthesisResult_->npu(src).linkTo(dest).send(chunk);
-            synthesisResult_->npu(dest).linkFrom(src).recv(chunk);
+            recordTransfer_(src, dest, chunk);
 
             // mark this postcondition as satisfied
             // i.e., remove this chunk from the postcondition map
@@ -211,7 +775,10 @@ void Synthesizer::expandTenTimestep_(PostconditionMap* const postconditionMap) n
 }
 
 std::optional<Synthesizer::ChunkID> Synthesizer::findReplacementChunk_(
-    const NpuID src, const NpuID dest, const PostconditionMap* const postconditionMap) noexcept {
+    const NpuID src,
+    const NpuID dest,
+    const ChunkID redundantChunk,
+    const PostconditionMap* const postconditionMap) noexcept {
     // trivial scenario: if dest has all postconditions satisfied,
     // there's no need for replacement
     if (postconditionMap->find(dest) == postconditionMap->end()) {
@@ -222,11 +789,16 @@ std::optional<Synthesizer::ChunkID> Synthesizer::findReplacementChunk_(
     auto candidates = std::vector<ChunkID>();
 
     // iterate over all unsatisfied postcondition of this dest NPU
+    const auto sized = collective_->sized();
     for (const auto chunk : postconditionMap->at(dest)) {
         // if this chunk is available at src NPU
         // but has not yet arrived at dest NPU,
         // this chunk can be a replacement candidate
         if (chunkMap_[chunk][src] && !chunkMap_[chunk][dest]) {
+            // (if it would have arrived no later than the redundant chunk)
+            if (sized && collective_->size(chunk) > collective_->size(redundantChunk)) {
+                continue;
+            }
             candidates.push_back(chunk);
         }
     }
@@ -236,6 +808,26 @@ std::optional<Synthesizer::ChunkID> Synthesizer::findReplacementChunk_(
         return std::nullopt;
     }
 
+    // let the custom policy choose, if any
+    if (policy_ != nullptr) {
+        const auto chunk = policy_->selectReplacement(state_(), src, dest, candidates);
+        assert(std::find(candidates.begin(), candidates.end(), chunk) != candidates.end());
+        return chunk;
+    }
+
+    // rarest first: keep only the candidates held by the fewest NPUs
+    if (replacementPolicy_ == ReplacementPolicy::RarestFirst && candidates.size() > 1) {
+        const auto rarest = *std::min_element(
+            candidates.begin(), candidates.end(),
+            [&](const ChunkID lhs, const ChunkID rhs) { return replicas_[lhs] < replicas_[rhs]; });
+        const auto fewestReplicas = replicas_[rarest];
+        candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                        [&](const ChunkID candidate) {
+                                            return replicas_[candidate] > fewestReplicas;
+                                        }),
+                         candidates.end());
+    }
+
     // if there's only one candidate, return it
     if (candidates.size() == 1) {
         return candidates[0];
@@ -247,7 +839,9 @@ std::optional<Synthesizer::ChunkID> Synthesizer::findReplacementChunk_(
     return candidates[idx];
 }
 
-void Synthesizer::linkChunkMatching_(const ChunkID chunk, const NpuID dest) noexcept {
+void Synthesizer::linkChunkMatching_(const ChunkID chunk,
+                                     const NpuID dest,
+                                     const PostconditionMap& postconditionMap) noexcept {
     // backtrack source NPUs
     auto sources = ten_->backtrack(dest);
 
@@ -264,7 +858,7 @@ void Synthesizer::linkChunkMatching_(const ChunkID chunk, const NpuID dest) noex
         }
 
         // if source has the chunk, check the link transfer time
-        const auto linkWeight = ten_->linkTransferTime(src, dest);
+        const auto linkWeight = transferTime_(src, dest, chunk);
         const auto linkTime = currentTime_ + linkWeight;
 
         // if this link time is equal to the minimum time
@@ -287,9 +881,8 @@ void Synthesizer::linkChunkMatching_(const ChunkID chunk, const NpuID dest) noex
         return;
     }
 
-    // randomly shuffle and select one source NPU to make link-chunk match
-    std::shuffle(candidates.begin(), candidates.end(), randomEngine);
-    const auto selectedSrc = candidates.front();
+    // select one source NPU to make link-chunk match
+    const auto selectedSrc = selectSource_(chunk, dest, std::move(candidates), postconditionMap);
 
     // mark the TEN as occupied
     ten_->transferChunk(selectedSrc, dest, chunk, arrivalTime);
@@ -298,7 +891,294 @@ void Synthesizer::linkChunkMatching_(const ChunkID chunk, const NpuID dest) noex
     eventQueue_.schedule(arrivalTime);
 }
 
-bool Synthesizer::isEqual(const Time lhs, const Time rhs) noexcept {
-    constexpr Time epsilon = 1e-9;
-    return std::abs(lhs - rhs) < epsilon;
+Synthesizer::NpuID Synthesizer::selectSource_(const ChunkID chunk,
+                                              const NpuID dest,
+                                              std::vector<NpuID> candidates,
+                                              const PostconditionMap& postconditionMap) noexcept {
+    assert(!candidates.empty());
+
+    // let the custom policy choose, if any
+    if (policy_ != nullptr) {
+        const auto src = policy_->selectSource(state_(), chunk, dest, candidates);
+        assert(std::find(candidates.begin(), candidates.end(), src) != candidates.end());
+        return src;
+    }
+
+    // greedily, keep only the least loaded senders, i.e., those with the most free egress links
+    if (matchingPolicy_ == MatchingPolicy::Greedy && candidates.size() > 1) {
+        auto maxFreeLinks = -1;
+        auto leastLoaded = std::vector<NpuID>();
+        for (const auto src : candidates) {
+            auto freeLinks = 0;
+            for (auto npu = 0; npu < npusCount; npu++) {
+                if (topology_->connected(src, npu) && ten_->available(src, npu)) {
+                    freeLinks++;
+                }
+            }
+            if (freeLinks == maxFreeLinks) {
+                leastLoaded.push_back(src);
+            } else if (freeLinks > maxFreeLinks) {
+                maxFreeLinks = freeLinks;
+                leastLoaded.assign(1, src);
+            }
+        }
+        candidates = std::move(leastLoaded);
+    }
+
+    // with lookahead, keep only the candidates whose link is the least needed by other chunks
+    if (matchingPolicy_ == MatchingPolicy::Lookahead && candidates.size() > 1) {
+        auto minCost = std::numeric_limits<double>::max();
+        auto leastNeeded = std::vector<NpuID>();
+        for (const auto src : candidates) {
+            const auto cost = lookaheadCost_(src, dest, chunk, postconditionMap);
+            if (isEqual(cost, minCost)) {
+                leastNeeded.push_back(src);
+            } else if (cost < minCost) {
+                minCost = cost;
+                leastNeeded.assign(1, src);
+            }
+        }
+        candidates = std::move(leastNeeded);
+    }
+
+    // randomly shuffle and select one source NPU
+    std::shuffle(candidates.begin(), candidates.end(), randomEngine);
+    return candidates.front();
+}
+
+void Synthesizer::relayIdleLinks_(const PostconditionMap& postconditionMap) noexcept {
+    if (speculativeTransfers_ >= maxSpeculativeTransfers_) {
+        return;
+    }
+
+    // unsatisfied destination NPUs of every pending chunk
+    auto pendingDests = std::unordered_map<ChunkID, std::vector<NpuID>>();
+    for (const auto& [dest, chunks] : postconditionMap) {
+        for (const auto chunk : chunks) {
+            pendingDests[chunk].push_back(dest);
+        }
+    }
+
+    // reach[chunk][i]: fewest hops from a holder or a receiver of the chunk
+    // to its i-th unsatisfied destination NPU
+    auto reach = std::unordered_map<ChunkID, std::vector<int>>();
+    auto reached = [&](const ChunkID chunk, const NpuID npu) {
+        const auto& dests = pendingDests.at(chunk);
+        auto& hops = reach[chunk];
+        for (auto i = 0; i < static_cast<int>(dests.size()); i++) {
+            if (hops_[npu][dests[i]] >= 0) {
+                hops[i] = std::min(hops[i], hops_[npu][dests[i]]);
+            }
+        }
+    };
+    for (const auto& [chunk, dests] : pendingDests) {
+        reach[chunk].assign(dests.size(), std::numeric_limits<int>::max());
+        for (auto npu = 0; npu < npusCount; npu++) {
+            if (chunkMap_[chunk][npu]) {
+                reached(chunk, npu);
+            }
+        }
+    }
+
+    // collect the idle links, and count the chunks in flight as already received
+    auto idleLinks = std::vector<std::pair<NpuID, NpuID>>();
+    for (auto src = 0; src < npusCount; src++) {
+        for (auto dest = 0; dest < npusCount; dest++) {
+            if (!topology_->connected(src, dest)) {
+                continue;
+            }
+            if (ten_->available(src, dest)) {
+                idleLinks.emplace_back(src, dest);
+                continue;
+            }
+            const auto chunk = ten_->chunk(src, dest);
+            if (pendingDests.find(chunk) != pendingDests.end()) {
+                reached(chunk, dest);
+            }
+        }
+    }
+    std::shuffle(idleLinks.begin(), idleLinks.end(), randomEngine);
+
+    for (const auto& [src, dest] : idleLinks) {
+        if (speculativeTransfers_ >= maxSpeculativeTransfers_) {
+            return;
+        }
+
+        // among the chunks that dest would bring strictly closer to a destination,
+        // pick the rarest one, then the one making the largest progress
+        auto bestKey = std::pair<int, int>(std::numeric_limits<int>::max(), 0);
+        auto candidates = std::vector<ChunkID>();
+        for (const auto& [chunk, dests] : pendingDests) {
+            if (!chunkMap_[chunk][src] || chunkMap_[chunk][dest]) {
+                continue;
+            }
+
+            const auto& hops = reach.at(chunk);
+            auto progress = 0;
+            for (auto i = 0; i < static_cast<int>(dests.size()); i++) {
+                if (hops_[dest][dests[i]] >= 0) {
+                    progress = std::max(progress, hops[i] - hops_[dest][dests[i]]);
+                }
+            }
+            if (progress <= 0) {
+                continue;
+            }
+
+            const auto key = std::pair<int, int>(replicas_[chunk], -progress);
+            if (key == bestKey) {
+                candidates.push_back(chunk);
+            } else if (key < bestKey) {
+                bestKey = key;
+                candidates.assign(1, chunk);
+            }
+        }
+
+        if (candidates.empty()) {
+            continue;
+        }
+
+        // randomly select one chunk and relay it
+        auto dist = std::uniform_int_distribution<>(0, candidates.size() - 1);
+        const auto chunk = candidates[dist(randomEngine)];
+        const auto arrivalTime = currentTime_ + transferTime_(src, dest, chunk);
+        ten_->transferChunk(src, dest, chunk, arrivalTime);
+        eventQueue_.schedule(arrivalTime);
+
+        speculative_[src][dest] = true;
+        speculativeTransfers_++;
+        reached(chunk, dest);
+    }
+}
+
+void Synthesizer::relayChunks_(const std::vector<Condition>& postcondition) noexcept {
+    // NPUs every chunk is in flight to
+    auto incoming = std::unordered_map<ChunkID, std::vector<NpuID>>();
+    for (auto src = 0; src < npusCount; src++) {
+        for (auto dest = 0; dest < npusCount; dest++) {
+            if (topology_->connected(src, dest) && ten_->chunk(src, dest) >= 0) {
+                incoming[ten_->chunk(src, dest)].push_back(dest);
+            }
+        }
+    }
+
+    for (const auto& [chunk, dest] : postcondition) {
+        // the link-chunk matching delivers the chunk once a holder neighbors dest
+        auto nearest = std::numeric_limits<Time>::max();
+        auto adjacent = false;
+        for (auto npu = 0; npu < npusCount && !adjacent; npu++) {
+            if (chunkMap_[chunk][npu]) {
+                nearest = std::min(nearest, pathTimes_[npu][dest]);
+                adjacent = topology_->connected(npu, dest);
+            }
+        }
+        if (adjacent) {
+            continue;
+        }
+
+        // the chunk is already on its way if it is in flight to an NPU closer to dest
+        auto& receivers = incoming[chunk];
+        const auto onItsWay = std::any_of(receivers.begin(), receivers.end(), [&](const NpuID npu) {
+            return npu == dest || pathTimes_[npu][dest] < nearest;
+        });
+        if (onItsWay) {
+            continue;
+        }
+
+        // forward the chunk from one of its closest holders to a free neighbor on a shortest path
+        auto candidates = std::vector<std::pair<NpuID, NpuID>>();
+        for (auto src = 0; src < npusCount; src++) {
+            if (!chunkMap_[chunk][src] || !isEqual(pathTimes_[src][dest], nearest)) {
+                continue;
+            }
+            for (auto via = 0; via < npusCount; via++) {
+                if (!topology_->connected(src, via) || !ten_->available(src, via) ||
+                    chunkMap_[chunk][via]) {
+                    continue;
+                }
+                const auto pathTime = ten_->linkTransferTime(src, via) + pathTimes_[via][dest];
+                if (isEqual(pathTime, nearest)) {
+                    candidates.emplace_back(src, via);
+                }
+            }
+        }
+        if (candidates.empty()) {
+            continue;
+        }
+
+        auto dist = std::uniform_int_distribution<>(0, candidates.size() - 1);
+        const auto [src, via] = candidates[dist(randomEngine)];
+        const auto arrivalTime = currentTime_ + transferTime_(src, via, chunk);
+        ten_->transferChunk(src, via, chunk, arrivalTime);
+        eventQueue_.schedule(arrivalTime);
+        receivers.push_back(via);
+    }
+}
+
+Synthesizer::Time Synthesizer::transferTime_(const NpuID src,
+                                             const NpuID dest,
+                                             const ChunkID chunk) const noexcept {
+    const auto size = collective_->size(chunk);
+    return (size > 0) ? ten_->linkTransferTime(src, dest, size)
+                      : ten_->linkTransferTime(src, dest);
+}
+
+SynthesisPolicy::State Synthesizer::state_() noexcept {
+    return {*topology_, *collective_, *ten_, chunkMap_, replicas_, hops_, currentTime_,
+            randomEngine};
+}
+
+bool Synthesizer::pending_(const ChunkID chunk) const noexcept {
+    const auto& dests = collective_->postcondition(chunk);
+    return std::any_of(dests.begin(), dests.end(),
+                       [&](const NpuID dest) { return !chunkMap_[chunk][dest]; });
+}
+
+Synthesizer::Time Synthesizer::releaseTime_(const ChunkID chunk) const noexcept {
+    return issueTime_ + collective_->releaseTime(chunk);
+}
+
+double Synthesizer::lookaheadCost_(const NpuID src,
+                                   const NpuID dest,
+                                   const ChunkID chunk,
+                                   const PostconditionMap& postconditionMap) const noexcept {
+    const auto it = postconditionMap.find(dest);
+    if (it == postconditionMap.end()) {
+        return 0;
+    }
+
+    const auto& feeders = topology_->backtrack(dest);
+    auto cost = 0.0;
+    for (const auto other : it->second) {
+        // only the chunks this link could deliver matter
+        if (other == chunk || !chunkMap_[other][src]) {
+            continue;
+        }
+
+        // skip the chunks already on their way to dest
+        const auto inFlight = std::any_of(feeders.begin(), feeders.end(), [&](const NpuID npu) {
+            return ten_->chunk(npu, dest) == other;
+        });
+        if (inFlight) {
+            continue;
+        }
+
+        // the farther the chunk is from dest without src,
+        // and the fewer free links can deliver it right now, the more it needs this link
+        auto nearest = npusCount;
+        auto alternatives = 0;
+        for (auto npu = 0; npu < npusCount; npu++) {
+            if (npu == src || !chunkMap_[other][npu]) {
+                continue;
+            }
+            if (hops_[npu][dest] >= 0) {
+                nearest = std::min(nearest, hops_[npu][dest]);
+            }
+            if (topology_->connected(npu, dest) && ten_->available(npu, dest)) {
+                alternatives++;
+            }
+        }
+        cost += nearest / (1.0 + alternatives);
+    }
+
+    return cost;
 }
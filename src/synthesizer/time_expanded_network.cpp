@@ -6,7 +6,9 @@ Copyright (c) 2022-2025 Intel Corporation
 Copyright (c) 2022-2025 Georgia Institute of Technology
 *******************************************************************************/
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 #include <memory>
 #include <tacos/synthesizer/time_expanded_network.h>
 
@@ -29,6 +31,21 @@ TimeExpandedNetwork::TimeExpandedNetwork(const Topology& topology,
     computeLinkTimes_(chunkSize);
 }
 
+void TimeExpandedNetwork::reset(const ChunkSize chunkSize) noexcept {
+    assert(chunkSize > 0);
+    currentTime_ = -1;
+    npusCount_ = topology_.npusCount();
+
+    // free all links (assign keeps the allocated storage)
+    linkBusyUntil_.assign(npusCount_, std::vector<Time>(npusCount_, -1));
+    chunk_.assign(npusCount_, std::vector<ChunkID>(npusCount_, -1));
+    available_.assign(npusCount_, std::vector<bool>(npusCount_, false));
+    linkTransferTimes_.assign(npusCount_, std::vector<Time>(npusCount_, -1));
+
+    // only the link transfer times depend on the chunk size
+    computeLinkTimes_(chunkSize);
+}
+
 bool TimeExpandedNetwork::available(const NpuID src, const NpuID dest) const noexcept {
     assert(0 <= src && src < npusCount_);
     assert(0 <= dest && dest < npusCount_);
@@ -71,7 +88,11 @@ void TimeExpandedNetwork::timestep(const Time time) noexcept {
             }
 
             // otherwise, reset the link availability
+            // (a link occupied without a chunk transfer simply becomes free)
             available_[src][dest] = topology_.connected(src, dest);
+            if (chunk_[src][dest] < 0) {
+                linkBusyUntil_[src][dest] = -1;
+            }
         }
     }
 }
@@ -85,6 +106,14 @@ TimeExpandedNetwork::ChunkID TimeExpandedNetwork::chunk(const NpuID src,
     return chunk_[src][dest];
 }
 
+TimeExpandedNetwork::Time TimeExpandedNetwork::busyUntil(const NpuID src,
+                                                         const NpuID dest) const noexcept {
+    assert(0 <= src && src < npusCount_);
+    assert(0 <= dest && dest < npusCount_);
+
+    return linkBusyUntil_[src][dest];
+}
+
 void TimeExpandedNetwork::transferChunk(const NpuID src,
                                         const NpuID dest,
                                         const ChunkID chunk,
@@ -104,6 +133,17 @@ void TimeExpandedNetwork::transferChunk(const NpuID src,
     linkBusyUntil_[src][dest] = time;
 }
 
+void TimeExpandedNetwork::occupy(const NpuID src, const NpuID dest, const Time time) noexcept {
+    assert(0 <= src && src < npusCount_);
+    assert(0 <= dest && dest < npusCount_);
+    assert(time > currentTime_);
+    assert(linkBusyUntil_[src][dest] < 0);
+
+    // the link carries no chunk of this synthesis meanwhile
+    available_[src][dest] = false;
+    linkBusyUntil_[src][dest] = time;
+}
+
 void TimeExpandedNetwork::transferFinished(const NpuID src, const NpuID dest) noexcept {
     assert(0 <= src && src < npusCount_);
     assert(0 <= dest && dest < npusCount_);
@@ -126,6 +166,50 @@ TimeExpandedNetwork::Time TimeExpandedNetwork::linkTransferTime(const NpuID src,
     return linkTime;
 }
 
+TimeExpandedNetwork::Time TimeExpandedNetwork::linkTransferTime(
+    const NpuID src, const NpuID dest, const ChunkSize chunkSize) const noexcept {
+    assert(0 <= src && src < npusCount_);
+    assert(0 <= dest && dest < npusCount_);
+    assert(topology_.connected(src, dest));
+
+    return alphaBetaModel_(topology_.bandwidth(src, dest), topology_.latency(src, dest),
+                           chunkSize);
+}
+
+std::vector<std::vector<TimeExpandedNetwork::Time>> TimeExpandedNetwork::shortestPathTimes()
+    const noexcept {
+    const auto infinity = std::numeric_limits<Time>::max();
+
+    // link transfer times, then all-pairs shortest paths (Floyd-Warshall)
+    auto times = std::vector<std::vector<Time>>(npusCount_, std::vector<Time>(npusCount_));
+    for (auto src = 0; src < npusCount_; src++) {
+        for (auto dest = 0; dest < npusCount_; dest++) {
+            if (src == dest) {
+                times[src][dest] = 0;
+            } else if (topology_.connected(src, dest)) {
+                times[src][dest] = linkTransferTimes_[src][dest];
+            } else {
+                times[src][dest] = infinity;
+            }
+        }
+    }
+    for (auto via = 0; via < npusCount_; via++) {
+        for (auto src = 0; src < npusCount_; src++) {
+            if (times[src][via] == infinity) {
+                continue;
+            }
+            for (auto dest = 0; dest < npusCount_; dest++) {
+                if (times[via][dest] == infinity) {
+                    continue;
+                }
+                times[src][dest] = std::min(times[src][dest], times[src][via] + times[via][dest]);
+            }
+        }
+    }
+
+    return times;
+}
+
 void TimeExpandedNetwork::computeLinkTimes_(const ChunkSize chunkSize) noexcept {
     assert(chunkSize > 0);
 
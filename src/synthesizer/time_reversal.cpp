@@ -0,0 +1,331 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <optional>
+#include <set>
+#include <tacos/synthesizer/time_expanded_network.h>
+#include <tacos/synthesizer/time_reversal.h>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief A transfer of the reversed schedule
+struct Transfer {
+    /// @brief source NPU ID
+    Topology::NpuID src;
+
+    /// @brief destination NPU ID
+    Topology::NpuID dest;
+
+    /// @brief transferred (partial) chunk ID
+    Collective::ChunkID chunk;
+
+    /// @brief arrival time of the matching transfer in the dual schedule
+    EventQueue::Time dualTime;
+
+    /// @brief true if the transfer gathers a reduced chunk back, false if it reduces one
+    bool gather;
+
+    /// @brief arrival time of the chunk at dest
+    EventQueue::Time time;
+};
+
+}  // namespace
+
+SynthesisResult TimeReversal::reverse(
+    const Topology& topology,
+    const Collective& collective,
+    const ChunkSize chunkSize,
+    SynthesisResult& dualResult,
+    const Time reductionTime,
+    const std::vector<std::vector<Time>>& linksBusyUntil,
+    const Time issueTime) noexcept {
+    assert(collective.reduction());
+    assert(issueTime >= 0);
+    assert(!collective.replicated());
+    assert(chunkSize > 0);
+    assert(reductionTime >= 0);
+
+    const auto npusCount = topology.npusCount();
+    const auto chunksCount = collective.chunksCount();
+    const auto ten = TimeExpandedNetwork(topology, chunkSize);
+
+    // flip every transfer of the dual schedule
+    auto transfers = std::vector<Transfer>();
+    for (auto src = 0; src < npusCount; src++) {
+        for (const auto& [dest, link] : dualResult.npu(src).egressLinks()) {
+            assert(topology.connected(dest, src));
+            for (const auto& [opId, op] : link.ops()) {
+                transfers.push_back({dest, src, op.chunkId(), op.time(), false, -1});
+            }
+        }
+    }
+
+    // rank: length of the chain of same-time dual transfers leading to a transfer,
+    // as a replacement chunk may be forwarded at the time it arrives
+    const auto reductionsCount = static_cast<int>(transfers.size());
+    auto deliverers = std::vector<std::vector<int>>(chunksCount, std::vector<int>(npusCount, -1));
+    for (auto index = 0; index < reductionsCount; index++) {
+        deliverers[transfers[index].chunk][transfers[index].src] = index;
+    }
+    auto ranks = std::vector<int>(reductionsCount, -1);
+    const std::function<int(int)> rank = [&](const int index) {
+        if (ranks[index] < 0) {
+            const auto& transfer = transfers[index];
+            const auto deliverer = deliverers[transfer.chunk][transfer.dest];
+            const auto chained =
+                (deliverer >= 0 && transfers[deliverer].dualTime == transfer.dualTime);
+            ranks[index] = chained ? rank(deliverer) + 1 : 0;
+        }
+        return ranks[index];
+    };
+
+    // reduced chunks gathered back replay the dual transfers themselves
+    if (collective.gathered()) {
+        transfers.reserve(2 * reductionsCount);
+        for (auto index = 0; index < reductionsCount; index++) {
+            const auto& transfer = transfers[index];
+            transfers.push_back({transfer.dest, transfer.src, transfer.chunk, transfer.dualTime,
+                                 true, -1});
+        }
+    }
+    const auto transfersCount = static_cast<int>(transfers.size());
+    const auto dualRank = [&](const int index) { return rank(index % reductionsCount); };
+
+    // every link reduces the latest dual transfers first, so that every transfer follows
+    // the transfers its partial chunk waits for, and gathers back the chunks reduced first
+    auto linkIds = std::vector<std::vector<int>>(npusCount, std::vector<int>(npusCount, -1));
+    auto linkEnds = std::vector<std::pair<NpuID, NpuID>>();
+    auto egressLinks = std::vector<std::vector<int>>(npusCount);
+    for (const auto& transfer : transfers) {
+        auto& linkId = linkIds[transfer.src][transfer.dest];
+        if (linkId < 0) {
+            linkId = static_cast<int>(linkEnds.size());
+            linkEnds.emplace_back(transfer.src, transfer.dest);
+            egressLinks[transfer.src].push_back(linkId);
+        }
+    }
+    const auto linksCount = static_cast<int>(linkEnds.size());
+    auto queues = std::vector<std::vector<int>>(linksCount);
+    for (auto index = 0; index < reductionsCount; index++) {
+        queues[linkIds[transfers[index].src][transfers[index].dest]].push_back(index);
+    }
+    for (auto& queue : queues) {
+        std::stable_sort(queue.begin(), queue.end(), [&](const int lhs, const int rhs) {
+            return std::make_pair(transfers[lhs].dualTime, rank(lhs)) >
+                   std::make_pair(transfers[rhs].dualTime, rank(rhs));
+        });
+    }
+
+    // gathers[c][n]: transfers gathering the reduced chunk c back from NPU n
+    auto gathers = std::vector<std::vector<std::vector<int>>>(
+        chunksCount, std::vector<std::vector<int>>(npusCount));
+    for (auto index = reductionsCount; index < transfersCount; index++) {
+        gathers[transfers[index].chunk][transfers[index].src].push_back(index);
+    }
+
+    // arrivals[c][n]: arrival times of the partial chunks c at NPU n,
+    // out of expectedArrivals[c][n]
+    auto arrivals = std::vector<std::vector<std::vector<Time>>>(
+        chunksCount, std::vector<std::vector<Time>>(npusCount));
+    auto expectedArrivals = std::vector<std::vector<int>>(chunksCount, std::vector<int>(npusCount));
+    for (auto index = 0; index < reductionsCount; index++) {
+        expectedArrivals[transfers[index].chunk][transfers[index].dest]++;
+    }
+    const auto reduced = [&](const ChunkID chunk, const NpuID npu) {
+        // the partial chunks are reduced one at a time, in their order of arrival,
+        // into the partial chunk of npu once released
+        auto& times = arrivals[chunk][npu];
+        std::sort(times.begin(), times.end());
+        auto time = issueTime + collective.releaseTime(chunk);
+        for (const auto arrival : times) {
+            time = std::max(time, arrival) + reductionTime;
+        }
+        return time;
+    };
+    const auto fullyReduced = [&](const ChunkID chunk, const NpuID npu) {
+        return static_cast<int>(arrivals[chunk][npu].size()) == expectedArrivals[chunk][npu];
+    };
+
+    // gather transfers whose chunk is held by their source, by priority:
+    // (ready time, dual time, rank, index), or (dual time, ready time, rank, index) if dualFirst
+    using ReadyGather = std::tuple<Time, Time, int, int>;
+    auto readyGathers = std::vector<std::set<ReadyGather>>(linksCount);
+    auto dualFirst = false;
+    const auto hold = [&](const ChunkID chunk, const NpuID npu, const Time time) {
+        for (const auto index : gathers[chunk][npu]) {
+            const auto& transfer = transfers[index];
+            const auto dualTime = transfer.dualTime;
+            readyGathers[linkIds[transfer.src][transfer.dest]].emplace(
+                dualFirst ? dualTime : time, dualFirst ? time : dualTime, dualRank(index), index);
+        }
+    };
+    const auto readyTime = [&dualFirst](const ReadyGather& readyGather) {
+        return dualFirst ? std::get<1>(readyGather) : std::get<0>(readyGather);
+    };
+
+    // re-time the transfers as soon as possible: every link starts its next reduction once
+    // the partial chunk is fully reduced, and fills the gaps before it with ready gathers,
+    // the earliest transfer of all links first, once the link is no longer busy beforehand
+    auto busyUntil = std::vector<Time>(linksCount, 0);
+    if (!linksBusyUntil.empty()) {
+        for (auto linkId = 0; linkId < linksCount; linkId++) {
+            const auto [src, dest] = linkEnds[linkId];
+            busyUntil[linkId] = std::max(Time(0), linksBusyUntil[src][dest]);
+        }
+    }
+    auto linkFree = busyUntil;
+    auto heads = std::vector<int>(linksCount, 0);
+    auto nextStarts = std::vector<std::optional<std::tuple<Time, int, int>>>(linksCount);
+    auto starts = std::set<std::tuple<Time, int, int>>();
+    auto plannedStarts = std::vector<Time>(reductionsCount, -1);
+    auto order = std::vector<int>();
+    const auto update = [&](const int linkId, const bool gathering) {
+        if (nextStarts[linkId].has_value()) {
+            starts.erase(nextStarts[linkId].value());
+            nextStarts[linkId].reset();
+        }
+        const auto& queue = queues[linkId];
+        const auto reducing = heads[linkId] < static_cast<int>(queue.size());
+        if (reducing) {
+            const auto index = queue[heads[linkId]];
+            const auto& [src, dest, chunk, dualTime, gather, time] = transfers[index];
+            if (fullyReduced(chunk, src)) {
+                const auto start = std::max(linkFree[linkId], reduced(chunk, src));
+                nextStarts[linkId] = std::make_tuple(start, 0, linkId);
+            }
+        }
+        if (gathering && !readyGathers[linkId].empty()) {
+            // a gather never delays a reduction past its start in the reduction-only schedule,
+            // so that the reduced chunks are gathered back as early as they would be reduced
+            const auto start =
+                std::max(linkFree[linkId], readyTime(*readyGathers[linkId].begin()));
+            const auto [src, dest] = linkEnds[linkId];
+            const auto end = start + ten.linkTransferTime(src, dest);
+            if (!reducing || end <= plannedStarts[queue[heads[linkId]]]) {
+                nextStarts[linkId] = std::make_tuple(start, 1, linkId);
+            }
+        }
+        if (nextStarts[linkId].has_value()) {
+            starts.insert(nextStarts[linkId].value());
+        }
+    };
+    const auto schedule = [&](const bool gathering) {
+        for (auto& times : arrivals) {
+            std::fill(times.begin(), times.end(), std::vector<Time>());
+        }
+        linkFree = busyUntil;
+        std::fill(heads.begin(), heads.end(), 0);
+        if (gathering) {
+            for (auto chunk = 0; chunk < chunksCount; chunk++) {
+                const auto owner = collective.precondition(chunk);
+                if (fullyReduced(chunk, owner)) {
+                    hold(chunk, owner, reduced(chunk, owner));
+                }
+            }
+        }
+        for (auto linkId = 0; linkId < linksCount; linkId++) {
+            update(linkId, gathering);
+        }
+
+        order.clear();
+        while (!starts.empty()) {
+            const auto [start, gather, linkId] = *starts.begin();
+            auto index = -1;
+            if (gather) {
+                index = std::get<3>(*readyGathers[linkId].begin());
+                readyGathers[linkId].erase(readyGathers[linkId].begin());
+            } else {
+                index = queues[linkId][heads[linkId]];
+                heads[linkId]++;
+            }
+            auto& transfer = transfers[index];
+            const auto [src, dest] = linkEnds[linkId];
+            transfer.time = start + ten.linkTransferTime(src, dest);
+            order.push_back(index);
+            linkFree[linkId] = transfer.time;
+            if (gather) {
+                hold(transfer.chunk, dest, transfer.time);
+            } else {
+                arrivals[transfer.chunk][dest].push_back(transfer.time);
+                const auto owner = collective.precondition(transfer.chunk);
+                if (gathering && owner == dest && fullyReduced(transfer.chunk, dest)) {
+                    hold(transfer.chunk, dest, reduced(transfer.chunk, dest));
+                }
+            }
+
+            // the chunks held by dest (and the link itself) changed
+            update(linkId, gathering);
+            for (const auto egressLink : egressLinks[dest]) {
+                update(egressLink, gathering);
+            }
+        }
+    };
+
+    // the reductions alone first, whose start times bound the gathers then
+    schedule(false);
+    assert(static_cast<int>(order.size()) == reductionsCount);
+    if (collective.gathered()) {
+        for (auto index = 0; index < reductionsCount; index++) {
+            const auto& [src, dest, chunk, dualTime, gather, time] = transfers[index];
+            plannedStarts[index] = time - ten.linkTransferTime(src, dest);
+        }
+
+        // gather the earliest reduced chunks first, or follow the dual schedule where possible,
+        // whichever completes first
+        const auto gatheredTime = [&]() {
+            auto time = Time(0);
+            for (auto index = reductionsCount; index < transfersCount; index++) {
+                time = std::max(time, transfers[index].time);
+            }
+            return time;
+        };
+        schedule(true);
+        const auto readyFirstTime = gatheredTime();
+        auto readyFirstTransfers = transfers;
+        auto readyFirstOrder = order;
+        dualFirst = true;
+        schedule(true);
+        if (readyFirstTime <= gatheredTime()) {
+            transfers = std::move(readyFirstTransfers);
+            order = std::move(readyFirstOrder);
+        }
+    }
+    assert(static_cast<int>(order.size()) == transfersCount);
+
+    // record the transfers in their order of arrival,
+    // so that every partial chunk is sent after the ones reduced into it
+    std::stable_sort(order.begin(), order.end(), [&transfers](const int lhs, const int rhs) {
+        return transfers[lhs].time < transfers[rhs].time;
+    });
+    auto synthesisResult = SynthesisResult(topology, collective);
+    for (const auto index : order) {
+        const auto& [src, dest, chunk, dualTime, gather, time] = transfers[index];
+        synthesisResult.npu(src).linkTo(dest).send(chunk, time);
+        synthesisResult.npu(dest).linkFrom(src).recv(chunk, time, !gather);
+    }
+
+    // every chunk is complete once reduced at the NPU of its precondition,
+    // and gathered back to all NPUs of its postcondition, if any
+    auto collectiveTime = Time(0);
+    for (auto chunk = 0; chunk < chunksCount; chunk++) {
+        collectiveTime = std::max(collectiveTime, reduced(chunk, collective.precondition(chunk)));
+    }
+    for (auto index = reductionsCount; index < transfersCount; index++) {
+        collectiveTime = std::max(collectiveTime, transfers[index].time);
+    }
+    synthesisResult.collectiveTime(collectiveTime);
+    return synthesisResult;
+}
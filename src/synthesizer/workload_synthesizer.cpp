@@ -0,0 +1,104 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <optional>
+#include <set>
+#include <tacos/synthesizer/workload_synthesizer.h>
+#include <utility>
+
+using namespace tacos;
+
+Synthesizer& WorkloadSynthesizer::synthesizer() noexcept {
+    return synthesizer_;
+}
+
+WorkloadSynthesizer::Result WorkloadSynthesizer::solve(const Topology& topology,
+                                                       const Workload& workload) noexcept {
+    const auto npusCount = topology.npusCount();
+    const auto stepsCount = workload.stepsCount();
+
+    auto result = Result();
+    result.synthesisResults.reserve(stepsCount);
+    result.issueTimes.assign(stepsCount, 0);
+    result.completionTimes.assign(stepsCount, 0);
+    result.iterationTime = 0;
+
+    // steps whose dependencies are all synthesized, by issue time (then by step ID)
+    auto pendingDependencies = std::vector<int>(stepsCount);
+    auto dependents = std::vector<std::vector<StepID>>(stepsCount);
+    auto readySteps = std::set<std::pair<Time, StepID>>();
+    for (auto step = 0; step < stepsCount; step++) {
+        const auto& dependencies = workload.dependencies(step);
+        pendingDependencies[step] = static_cast<int>(dependencies.size());
+        for (const auto dependency : dependencies) {
+            dependents[dependency].push_back(step);
+        }
+        if (dependencies.empty()) {
+            readySteps.emplace(workload.computeTime(step), step);
+        }
+    }
+
+    // schedule of each step, synthesized out of step order
+    auto synthesisResults = std::vector<std::optional<SynthesisResult>>(stepsCount);
+
+    // time until which every link is busy with the transfers of the steps synthesized so far
+    auto linksBusyUntil =
+        std::vector<std::vector<Time>>(npusCount, std::vector<Time>(npusCount, 0));
+    while (!readySteps.empty()) {
+        // synthesize the step issued first, once its dependencies are complete and computed upon
+        const auto [issueTime, step] = *readySteps.begin();
+        readySteps.erase(readySteps.begin());
+        result.issueTimes[step] = issueTime;
+
+        // synthesize the step from its issue time,
+        // over the links left busy by the steps synthesized before
+        synthesizer_.issueTime(issueTime);
+        synthesizer_.linksBusyUntil(linksBusyUntil);
+        auto synthesisResult =
+            synthesizer_.solve(topology, workload.collective(step), workload.chunkSize(step));
+        for (auto src = 0; src < npusCount; src++) {
+            for (const auto& [dest, link] : synthesisResult.npu(src).egressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    linksBusyUntil[src][dest] = std::max(linksBusyUntil[src][dest], op.time());
+                }
+            }
+        }
+
+        const auto completionTime = synthesisResult.collectiveTime();
+        result.completionTimes[step] = completionTime;
+        result.iterationTime = std::max(result.iterationTime, completionTime);
+        synthesisResults[step] = std::move(synthesisResult);
+
+        // the dependents of the step are ready once all their dependencies are complete
+        for (const auto dependent : dependents[step]) {
+            pendingDependencies[dependent]--;
+            if (pendingDependencies[dependent] == 0) {
+                auto dependentIssueTime = Time(0);
+                for (const auto dependency : workload.dependencies(dependent)) {
+                    dependentIssueTime =
+                        std::max(dependentIssueTime, result.completionTimes[dependency]);
+                }
+                dependentIssueTime += workload.computeTime(dependent);
+                readySteps.emplace(dependentIssueTime, dependent);
+            }
+        }
+    }
+
+    // every step only depends on earlier steps, so that all of them were synthesized
+    for (auto& synthesisResult : synthesisResults) {
+        assert(synthesisResult.has_value());
+        result.synthesisResults.push_back(std::move(synthesisResult.value()));
+    }
+
+    // the synthesizer is left issuing on free links for its next uses
+    synthesizer_.issueTime(0);
+    synthesizer_.linksBusyUntil({});
+    return result;
+}
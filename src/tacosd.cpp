@@ -0,0 +1,69 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <tacos/service/synthesis_service.h>
+#include <tacos/service/unix_socket_server.h>
+#include <thread>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief Server to stop on SIGINT or SIGTERM (nullptr if not serving)
+std::atomic<UnixSocketServer*> runningServer = nullptr;
+
+/// @brief Stop the running server, which then removes its socket file
+void stopServer(int /*signal*/) {
+    auto* const server = runningServer.load();
+    if (server != nullptr) {
+        server->stop();
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    // usage: tacosd [socket path] [threads count]
+    const auto path = std::string(argc > 1 ? argv[1] : "/tmp/tacosd.sock");
+    const auto hardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+    const auto threadsCount = argc > 2 ? std::atoi(argv[2]) : std::max(1, hardwareThreads);
+    if (threadsCount <= 0) {
+        std::cerr << "Invalid threads count: " << argv[2] << std::endl;
+        return 1;
+    }
+
+    // writing to a disconnected client should not terminate the daemon
+    std::signal(SIGPIPE, SIG_IGN);
+
+    // create the synthesis service and serve requests
+    auto service = SynthesisService(threadsCount);
+    const auto handler = [&service](const std::string& line) { return service.handle(line); };
+    auto server = UnixSocketServer(path, handler);
+
+    // shut down cleanly when interrupted or terminated
+    runningServer = &server;
+    std::signal(SIGINT, stopServer);
+    std::signal(SIGTERM, stopServer);
+
+    std::cout << "[tacosd] Serving at " << path << " with " << threadsCount << " threads"
+              << std::endl;
+    const auto served = server.serve();
+    runningServer = nullptr;
+    if (!served) {
+        return 1;
+    }
+
+    // terminate
+    return 0;
+}
@@ -6,18 +6,29 @@ Copyright (c) 2022-2025 Intel Corporation
 Copyright (c) 2022-2025 Georgia Institute of Technology
 *******************************************************************************/
 
+#include <atomic>
 #include <cassert>
 #include <tacos/topology/topology.h>
 
 using namespace tacos;
 
-Topology::Topology() noexcept = default;
+namespace {
+
+/// @brief next generation to assign to a topology
+std::atomic<uint64_t> nextGeneration = 0;
+
+}  // namespace
+
+Topology::Topology() noexcept {
+    nextGeneration_();
+}
 
 void Topology::setNpusCount_(const int npusCount) noexcept {
     assert(npusCount > 0);
 
     // set npusCount
     npusCount_ = npusCount;
+    nextGeneration_();
 
     // allocate memory
     connected_ = decltype(connected_)(npusCount, std::vector<bool>(npusCount, false));
@@ -45,13 +56,68 @@ Topology::Latency Topology::latency(NpuID src, NpuID dest) const noexcept {
     return latencies_[src][dest];
 }
 
-std::vector<Topology::NpuID> Topology::backtrack(const NpuID dest) const noexcept {
+const std::vector<Topology::NpuID>& Topology::backtrack(const NpuID dest) const noexcept {
     assert(0 <= dest && dest < npusCount_);
     assert(backtrackMap_.size() == npusCount_);
 
     return backtrackMap_.at(dest);
 }
 
+std::vector<std::vector<int>> Topology::hopDistances() const noexcept {
+    auto hops = std::vector<std::vector<int>>(npusCount_, std::vector<int>(npusCount_, -1));
+
+    // breadth-first search from every dest, following the links backward
+    auto queue = std::vector<NpuID>();
+    for (auto dest = 0; dest < npusCount_; ++dest) {
+        hops[dest][dest] = 0;
+        queue.assign(1, dest);
+        for (auto i = 0; i < static_cast<int>(queue.size()); ++i) {
+            const auto npu = queue[i];
+            for (const auto src : backtrackMap_.at(npu)) {
+                if (hops[src][dest] < 0) {
+                    hops[src][dest] = hops[npu][dest] + 1;
+                    queue.push_back(src);
+                }
+            }
+        }
+    }
+
+    return hops;
+}
+
+std::vector<std::vector<Topology::Latency>> Topology::pathLatencies() const noexcept {
+    auto latencies =
+        std::vector<std::vector<Latency>>(npusCount_, std::vector<Latency>(npusCount_, -1));
+
+    // Floyd-Warshall over the link latencies
+    for (auto src = 0; src < npusCount_; ++src) {
+        latencies[src][src] = 0;
+        for (auto dest = 0; dest < npusCount_; ++dest) {
+            if (src != dest && connected_[src][dest]) {
+                latencies[src][dest] = latencies_[src][dest];
+            }
+        }
+    }
+    for (auto via = 0; via < npusCount_; ++via) {
+        for (auto src = 0; src < npusCount_; ++src) {
+            if (latencies[src][via] < 0) {
+                continue;
+            }
+            for (auto dest = 0; dest < npusCount_; ++dest) {
+                if (latencies[via][dest] < 0) {
+                    continue;
+                }
+                const auto latency = latencies[src][via] + latencies[via][dest];
+                if (latencies[src][dest] < 0 || latency < latencies[src][dest]) {
+                    latencies[src][dest] = latency;
+                }
+            }
+        }
+    }
+
+    return latencies;
+}
+
 void Topology::connect_(const NpuID src,
                         const NpuID dest,
                         Bandwidth bandwidth,
@@ -63,6 +129,7 @@ void Topology::connect_(const NpuID src,
     assert(latency >= 0);
 
     // connect src -> dest
+    nextGeneration_();
     connected_[src][dest] = true;
     bandwidths_[src][dest] = bandwidth;
     latencies_[src][dest] = latency;
@@ -86,3 +153,11 @@ int Topology::npusCount() const noexcept {
 
     return npusCount_;
 }
+
+uint64_t Topology::generation() const noexcept {
+    return generation_;
+}
+
+void Topology::nextGeneration_() noexcept {
+    generation_ = nextGeneration++;
+}
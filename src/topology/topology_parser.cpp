@@ -0,0 +1,130 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cstdint>
+#include <sstream>
+#include <tacos/topology/hetero_mesh_2d.h>
+#include <tacos/topology/hetero_mesh_3d.h>
+#include <tacos/topology/hypercube_3d.h>
+#include <tacos/topology/mesh_2d.h>
+#include <tacos/topology/mesh_2d_hetero.h>
+#include <tacos/topology/topology_parser.h>
+#include <tacos/topology/torus_2d.h>
+#include <tacos/topology/torus_3d.h>
+#include <vector>
+
+using namespace tacos;
+
+namespace {
+
+using Bandwidth = Topology::Bandwidth;
+using Latency = Topology::Latency;
+
+/// @brief Split a string by the given delimiter.
+std::vector<std::string> split(const std::string& str, const char delimiter) noexcept {
+    auto tokens = std::vector<std::string>();
+    auto stream = std::istringstream(str);
+    auto token = std::string();
+    while (std::getline(stream, token, delimiter)) {
+        tokens.push_back(token);
+    }
+    return tokens;
+}
+
+/// @brief Parse a whole token as a number, returning false if it is malformed.
+template <typename T>
+bool parseNumber(const std::string& token, T* const value) noexcept {
+    auto stream = std::istringstream(token);
+    stream >> *value;
+    return !stream.fail() && stream.eof();
+}
+
+}  // namespace
+
+std::unique_ptr<Topology> TopologyParser::parse(const std::string& spec,
+                                                const int maxNpusCount) noexcept {
+    const auto tokens = split(spec, ':');
+    if (tokens.size() < 3) {
+        return nullptr;
+    }
+
+    // parse dimensions, rejecting topologies with too many NPUs before constructing them
+    auto dims = std::vector<int>();
+    auto npusCount = int64_t(1);
+    for (const auto& token : split(tokens[1], 'x')) {
+        auto dim = 0;
+        if (!parseNumber(token, &dim) || dim <= 0) {
+            return nullptr;
+        }
+        npusCount *= dim;
+        if (npusCount > maxNpusCount) {
+            return nullptr;
+        }
+        dims.push_back(dim);
+    }
+
+    // parse links: bandwidth/latency pairs
+    auto bandwidths = std::vector<Bandwidth>();
+    auto latencies = std::vector<Latency>();
+    for (auto i = std::size_t(2); i < tokens.size(); i++) {
+        const auto link = split(tokens[i], '/');
+        auto bandwidth = Bandwidth();
+        auto latency = Latency();
+        if (link.size() != 2 || !parseNumber(link[0], &bandwidth) ||
+            !parseNumber(link[1], &latency) || bandwidth <= 0 || latency < 0) {
+            return nullptr;
+        }
+        bandwidths.push_back(bandwidth);
+        latencies.push_back(latency);
+    }
+
+    // construct the topology
+    const auto& kind = tokens[0];
+    const auto dimsCount = dims.size();
+    const auto linksCount = bandwidths.size();
+
+    if (dimsCount == 2 && linksCount == 1) {
+        if (kind == "mesh2d") {
+            return std::make_unique<Mesh2D>(dims[0], dims[1], bandwidths[0], latencies[0]);
+        }
+        if (kind == "torus2d") {
+            return std::make_unique<Torus2D>(dims[0], dims[1], bandwidths[0], latencies[0]);
+        }
+    }
+
+    if (dimsCount == 2 && linksCount == 2) {
+        if (kind == "mesh2d_hetero") {
+            return std::make_unique<Mesh2D_Hetero>(dims[0], dims[1], bandwidths[0], latencies[0],
+                                                   bandwidths[1], latencies[1]);
+        }
+        if (kind == "hetero_mesh2d") {
+            return std::make_unique<HeteroMesh2D>(dims[0], dims[1], bandwidths[0], latencies[0],
+                                                  bandwidths[1], latencies[1]);
+        }
+    }
+
+    if (dimsCount == 3 && linksCount == 1) {
+        if (kind == "torus3d") {
+            return std::make_unique<Torus3D>(dims[0], dims[1], dims[2], bandwidths[0],
+                                             latencies[0]);
+        }
+        if (kind == "hypercube3d") {
+            return std::make_unique<Hypercube3D>(dims[0], dims[1], dims[2], bandwidths[0],
+                                                 latencies[0]);
+        }
+    }
+
+    if (dimsCount == 3 && linksCount == 3 && kind == "hetero_mesh3d") {
+        return std::make_unique<HeteroMesh3D>(dims[0], dims[1], dims[2], bandwidths[0],
+                                              latencies[0], bandwidths[1], latencies[1],
+                                              bandwidths[2], latencies[2]);
+    }
+
+    // unknown kind or mismatching number of dims/links
+    return nullptr;
+}
@@ -0,0 +1,150 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <tacos/writer/bandwidth_report.h>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief Size of a float element, the data type reported by nccl-tests by default
+constexpr auto ElementSize = 4;
+
+/// @brief Format a collective time the way nccl-tests does
+std::string formatTime(const double time) noexcept {
+    char buffer[32];
+    if (time >= 10000.0) {
+        std::snprintf(buffer, sizeof(buffer), "%7.0f", time);
+    } else if (time >= 100.0) {
+        std::snprintf(buffer, sizeof(buffer), "%7.1f", time);
+    } else {
+        std::snprintf(buffer, sizeof(buffer), "%7.2f", time);
+    }
+    return buffer;
+}
+
+}  // namespace
+
+BandwidthReport::BandwidthReport(const CollectiveType type,
+                                 const int npusCount,
+                                 const int root) noexcept
+    : type_(type),
+      npusCount_(npusCount),
+      root_((type == CollectiveType::Broadcast || type == CollectiveType::Reduce) ? root : -1) {
+    assert(npusCount > 0);
+    assert(0 <= root && root < npusCount);
+}
+
+void BandwidthReport::add(const ChunkSize size, const Time collectiveTime) noexcept {
+    assert(size > 0);
+    assert(collectiveTime > 0);
+    rows_.push_back({size, collectiveTime});
+}
+
+double BandwidthReport::algorithmBandwidth(const int row) const noexcept {
+    assert(0 <= row && row < static_cast<int>(rows_.size()));
+
+    // bytes per microsecond -> GB/s (1 GB = 1e9 bytes, as in nccl-tests)
+    const auto& [size, time] = rows_[row];
+    return static_cast<double>(size) / time / 1e3;
+}
+
+double BandwidthReport::busBandwidth(const int row) const noexcept {
+    return algorithmBandwidth(row) * busBandwidthFactor(type_, npusCount_);
+}
+
+double BandwidthReport::busBandwidthFactor(const CollectiveType type,
+                                           const int npusCount) noexcept {
+    assert(npusCount > 0);
+    const auto n = static_cast<double>(npusCount);
+
+    switch (type) {
+    case CollectiveType::AllReduce:
+        return 2 * (n - 1) / n;
+    case CollectiveType::AllGather:
+    case CollectiveType::ReduceScatter:
+    case CollectiveType::AllToAll:
+        return (n - 1) / n;
+    case CollectiveType::Broadcast:
+    case CollectiveType::Reduce:
+        return 1;
+    }
+
+    assert(false);
+    return 1;
+}
+
+void BandwidthReport::print(std::ostream& os) const noexcept {
+    os << "#\n";
+    os << "#                                                              out-of-place"
+          "                       in-place          \n";
+    os << "#       size         count      type   redop    root     time   algbw   busbw #wrong"
+          "     time   algbw   busbw #wrong\n";
+    os << "#        (B)    (elements)                               (us)  (GB/s)  (GB/s)      "
+          "      (us)  (GB/s)  (GB/s)       \n";
+
+    auto busBandwidthSum = 0.0;
+    for (auto row = 0; row < static_cast<int>(rows_.size()); row++) {
+        const auto& [size, time] = rows_[row];
+        const auto algbw = algorithmBandwidth(row);
+        const auto busbw = busBandwidth(row);
+        busBandwidthSum += busbw;
+
+        char buffer[256];
+        auto length = std::snprintf(buffer, sizeof(buffer), "%12lld  %12lld  %8s  %6s  %6d",
+                                    static_cast<long long>(size),
+                                    static_cast<long long>(size / ElementSize), "float",
+                                    redop_(), root_);
+        // synthesized algorithms run in place: both column groups report the same values
+        for (auto i = 0; i < 2; i++) {
+            length += std::snprintf(buffer + length, sizeof(buffer) - length,
+                                    "  %7s  %6.2f  %6.2f  %5s", formatTime(time).c_str(), algbw,
+                                    busbw, "N/A");
+        }
+        os << buffer << "\n";
+    }
+
+    const auto rowsCount = static_cast<double>(rows_.size());
+    os << "# Out of bounds values : 0 OK\n";
+    os << "# Avg bus bandwidth    : " << (rows_.empty() ? 0 : busBandwidthSum / rowsCount)
+       << " \n";
+    os << "#" << std::endl;
+}
+
+bool BandwidthReport::writeCsv(const std::string& path) const noexcept {
+    auto csv = std::ofstream(path);
+    if (!csv) {
+        std::cout << "CSV file writing failed" << std::endl;
+        return false;
+    }
+
+    csv << "size,count,type,redop,root,time,algbw,busbw\n";
+    for (auto row = 0; row < static_cast<int>(rows_.size()); row++) {
+        const auto& [size, time] = rows_[row];
+        csv << size << "," << (size / ElementSize) << ",float," << redop_() << "," << root_
+            << "," << time << "," << algorithmBandwidth(row) << "," << busBandwidth(row) << "\n";
+    }
+
+    std::cout << "CSV file written at: " << path << std::endl;
+    return true;
+}
+
+const char* BandwidthReport::redop_() const noexcept {
+    switch (type_) {
+    case CollectiveType::AllReduce:
+    case CollectiveType::ReduceScatter:
+    case CollectiveType::Reduce:
+        return "sum";
+    default:
+        return "none";
+    }
+}
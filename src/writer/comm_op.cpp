@@ -10,8 +10,11 @@ Copyright (c) 2022-2025 Georgia Institute of Technology
 
 using namespace tacos;
 
-CommOp::CommOp(const ChunkID chunkId, const LinkID linkId, const OpID opId) noexcept
-    : chunkId_(chunkId), linkId_(linkId), opId_(opId) {}
+CommOp::CommOp(const ChunkID chunkId,
+               const LinkID linkId,
+               const OpID opId,
+               const Time time) noexcept
+    : chunkId_(chunkId), linkId_(linkId), opId_(opId), time_(time) {}
 
 void CommOp::setDepOp(CommOp* const depOp) {
     hasDep_ = true;
@@ -27,6 +30,14 @@ bool CommOp::depended() const noexcept {
     return depended_;
 }
 
+void CommOp::setReduction() {
+    reduction_ = true;
+}
+
+bool CommOp::reduction() const noexcept {
+    return reduction_;
+}
+
 Collective::ChunkID CommOp::chunkId() const noexcept {
     return chunkId_;
 }
@@ -46,3 +57,7 @@ CommOp::LinkID CommOp::linkId() const noexcept {
 CommOp::OpID CommOp::opId() const noexcept {
     return opId_;
 }
+
+CommOp::Time CommOp::time() const noexcept {
+    return time_;
+}
@@ -13,16 +13,16 @@ Copyright (c) 2022-2025 Georgia Institute of Technology
 using namespace tacos;
 
 LinkResult::LinkResult(const LinkID linkId, const LinkType type, NpuResult* const npu) noexcept
-    : id_(linkId), type_(type), npu_(*npu) {}
+    : id_(linkId), npu_(*npu), type_(type) {}
 
 LinkResult::LinkID LinkResult::id() const noexcept {
     return id_;
 }
 
-void LinkResult::send(const ChunkID chunk) noexcept {
+void LinkResult::send(const ChunkID chunk, const Time time) noexcept {
     assert(type_ == LinkType::Egress);
     const auto opId = currentOpId();
-    ops_.emplace(opId, CommOp(chunk, id(), opId));
+    ops_.emplace(opId, CommOp(chunk, id(), opId, time));
     auto& op = ops_.at(opId);
     auto* const depOp = npu_.getDep(chunk);
     if (depOp != nullptr) {
@@ -30,12 +30,21 @@ void LinkResult::send(const ChunkID chunk) noexcept {
     }
 }
 
-void LinkResult::recv(const ChunkID chunk) noexcept {
+void LinkResult::recv(const ChunkID chunk, const Time time, const bool reduction) noexcept {
     assert(type_ == LinkType::Ingress);
     const auto opId = currentOpId();
-    ops_.emplace(opId, CommOp(chunk, id(), opId));
+    ops_.emplace(opId, CommOp(chunk, id(), opId, time));
     auto* const depOp = &ops_.at(opId);
-    npu_.registerRecvDep(chunk, depOp);
+
+    // a recv reducing the chunk into a previously received copy waits for that copy
+    if (reduction) {
+        depOp->setReduction();
+        auto* const previousOp = npu_.getDep(chunk);
+        if (previousOp != nullptr) {
+            depOp->setDepOp(previousOp);
+        }
+    }
+    npu_.registerRecvDep(chunk, depOp, reduction);
 }
 
 LinkResult::OpID LinkResult::currentOpId() noexcept {
@@ -45,9 +45,18 @@ LinkResult& NpuResult::linkTo(const NpuID id) noexcept {
     return egressLinks_.at(id);
 }
 
-void NpuResult::registerRecvDep(const ChunkID chunk, CommOp* const depOp) noexcept {
-    assert(depRecvOp_.find(chunk) == depRecvOp_.end());
-    depRecvOp_.emplace(chunk, depOp);
+void NpuResult::registerRecvDep(const ChunkID chunk,
+                                CommOp* const depOp,
+                                const bool reduction) noexcept {
+    // a chunk is received again only when it is reduced into the previous partial copy,
+    // or once fully reduced, in place of its partial copy
+    if (reduction) {
+        partialChunks_.insert(chunk);
+    } else {
+        assert(depRecvOp_.find(chunk) == depRecvOp_.end() || partialChunks_.count(chunk) > 0);
+        partialChunks_.erase(chunk);
+    }
+    depRecvOp_[chunk] = depOp;
 }
 
 CommOp* NpuResult::getDep(const ChunkID chunk) noexcept {
@@ -20,6 +20,9 @@ SynthesisResult::SynthesisResult(const Topology& topology, const Collective& col
     for (auto chunk = 0; chunk < collective.chunksCount(); chunk++) {
         const auto src = collective.precondition(chunk);
         npus_[src].registerRecvDep(chunk, nullptr);
+        for (const auto replica : collective.replicas(chunk)) {
+            npus_[replica].registerRecvDep(chunk, nullptr);
+        }
     }
 }
 
@@ -37,3 +40,28 @@ EventQueue::Time SynthesisResult::collectiveTime() const noexcept {
     assert(collectiveTime_ > 0);
     return collectiveTime_;
 }
+
+bool SynthesisResult::sameSchedule(const SynthesisResult& other) const noexcept {
+    assert(npusCount_ == other.npusCount_);
+
+    for (auto npu = 0; npu < npusCount_; npu++) {
+        const auto& links = npus_[npu].egressLinks();
+        const auto& otherLinks = other.npus_[npu].egressLinks();
+        assert(links.size() == otherLinks.size());
+
+        for (const auto& [dest, link] : links) {
+            const auto& ops = link.ops();
+            const auto& otherOps = otherLinks.at(dest).ops();
+            if (ops.size() != otherOps.size()) {
+                return false;
+            }
+            for (const auto& [opId, op] : ops) {
+                if (op.chunkId() != otherOps.at(opId).chunkId()) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
@@ -6,8 +6,14 @@ Copyright (c) 2022-2025 Intel Corporation
 Copyright (c) 2022-2025 Georgia Institute of Technology
 *******************************************************************************/
 
+#include <algorithm>
+#include <cassert>
+#include <functional>
 #include <iostream>
+#include <map>
 #include <tacos/writer/xml_writer.h>
+#include <tuple>
+#include <utility>
 
 using namespace tacos;
 
@@ -17,7 +23,29 @@ XmlWriter::XmlWriter(const std::string& filename,
                      SynthesisResult& synthesisResult) noexcept
     : path(filename), topology_(topology), collective_(collective), synthesisResult_(synthesisResult) {}
 
+void XmlWriter::channels(const int channelsCount, const ChannelPolicy policy) noexcept {
+    assert(channelsCount > 0);
+    channelsCount_ = channelsCount;
+    channelPolicy_ = policy;
+}
+
+void XmlWriter::fuseThreadblocks(const int maxThreadblocks) noexcept {
+    fuseThreadblocks_ = true;
+    maxThreadblocks_ = maxThreadblocks;
+}
+
+void XmlWriter::bytes(const ChunkSize minBytes, const ChunkSize maxBytes) noexcept {
+    assert(0 <= minBytes && minBytes <= maxBytes);
+    minBytes_ = minBytes;
+    maxBytes_ = maxBytes;
+}
+
+void XmlWriter::coalesceSteps() noexcept {
+    coalesceSteps_ = true;
+}
+
 void XmlWriter::write() noexcept {
+    groupOps();
     writeAlgo();
     for (auto npu = 0; npu < topology_.npusCount(); npu++) {
         writeNpu(npu);
@@ -29,83 +57,552 @@ void XmlWriter::writeAlgo() noexcept {
     algo = xml.append_child("algo");
     algo.append_attribute("name") = "tacos";
     algo.append_attribute("proto") = "Simple";
-    algo.append_attribute("nchannels") = 1;
-    algo.append_attribute("nchunksperloop") = collective_.chunksCount();
+    algo.append_attribute("nchannels") = channelsCount_;
+    algo.append_attribute("nchunksperloop") = chunksPerLoop();
     algo.append_attribute("ngpus") = topology_.npusCount();
-    algo.append_attribute("coll") = "allgather";
+    algo.append_attribute("coll") = collective_.name().c_str();
     algo.append_attribute("inplace") = 1;
     algo.append_attribute("outofplace") = 0;
-    algo.append_attribute("minBytes") = 0;
-    algo.append_attribute("maxBytes") = 0;
+    algo.append_attribute("minBytes") = minBytes_;
+    algo.append_attribute("maxBytes") = maxBytes_;
 }
 
 void XmlWriter::writeNpu(NpuID npuId) noexcept {
     auto npu = algo.append_child("gpu");
     npu.append_attribute("id") = npuId;
-    npu.append_attribute("i_chunks") = 0;
-    npu.append_attribute("o_chunks") = collective_.chunksCount();
+    if (collective_.reduction()) {
+        // partial chunks are reduced in place in the input buffer,
+        // whose reduced chunks of this NPU (or all of them, once gathered) make the output buffer
+        auto ownedChunks = 0;
+        for (auto chunk = 0; chunk < collective_.chunksCount(); chunk++) {
+            ownedChunks += (collective_.precondition(chunk) == npuId);
+        }
+        const auto reducedChunks = ownedChunks * (chunksPerLoop() / collective_.chunksCount());
+        npu.append_attribute("i_chunks") = chunksPerLoop();
+        npu.append_attribute("o_chunks") = collective_.gathered() ? chunksPerLoop() : reducedChunks;
+    } else {
+        npu.append_attribute("i_chunks") = 0;
+        npu.append_attribute("o_chunks") = chunksPerLoop();
+    }
     npu.append_attribute("s_chunks") = 0;
-    for (const auto& [src, link] : synthesisResult_.npu(npuId).ingressLinks()) {
-        writeIngressLink(npu, npuId, src, link);
+    auto threadblocks = assignChannels(npuId);
+    if (fuseThreadblocks_) {
+        threadblocks = fuseThreadblocks(npuId, threadblocks);
+        if (collective_.reduction()) {
+            threadblocks = fuseReductions(threadblocks);
+        }
     }
-    for (const auto& [dest, link] : synthesisResult_.npu(npuId).egressLinks()) {
-        writeEgressLink(npu, npuId, dest, link);
+    for (auto id = 0; id < static_cast<int>(threadblocks.size()); id++) {
+        writeThreadblock(npu, id, threadblocks[id]);
     }
 }
 
-void XmlWriter::save() noexcept {
-    if (xml.save_file(path.c_str(), PUGIXML_TEXT("\t"), pugi::format_no_declaration)) {
-        std::cout << "XML file written at: " << path << std::endl;
-    } else {
-        std::cout << "XML file writing failed" << std::endl;
+void XmlWriter::groupOps() noexcept {
+    // match every recv op with the send op of the other end of its link:
+    // both ends record the ops of a link in the same order
+    matchingSend_.clear();
+    for (auto src = 0; src < topology_.npusCount(); src++) {
+        for (const auto& [dest, link] : synthesisResult_.npu(src).egressLinks()) {
+            const auto& recvOps = synthesisResult_.npu(dest).linkFrom(src).ops();
+            assert(recvOps.size() == link.ops().size());
+            for (const auto& [opId, op] : link.ops()) {
+                matchingSend_[&recvOps.at(opId)] = &op;
+            }
+        }
+    }
+
+    // rank: length of the chain of same-time dependencies leading to an op
+    // a recv waits for its matching send, and a send waits for its dependency,
+    // which may be a recv of the same time when a replacement chunk was forwarded
+    // (a recv reducing a chunk also waits for the previous recv of the chunk)
+    auto ranks = std::unordered_map<const CommOp*, int>();
+    const std::function<int(const CommOp*)> rank = [&](const CommOp* const op) {
+        const auto it = ranks.find(op);
+        if (it != ranks.end()) {
+            return it->second;
+        }
+        auto opRank = 0;
+        const auto send = matchingSend_.find(op);
+        if (send != matchingSend_.end()) {
+            opRank = rank(send->second) + 1;
+        }
+        if (op->hasDep() && op->depOp()->time() == op->time()) {
+            opRank = std::max(opRank, rank(op->depOp()) + 1);
+        }
+        ranks[op] = opRank;
+        return opRank;
+    };
+    auto matchingRecv = std::unordered_map<const CommOp*, const CommOp*>();
+    for (const auto& [recv, send] : matchingSend_) {
+        matchingRecv[send] = recv;
+    }
+
+    // sort all send ops by (time, rank), ties broken by their location:
+    // every dependency of a send (and every earlier op of its link) comes first
+    struct SendOp {
+        const CommOp* op;
+        NpuID src;
+        const LinkResult* link;
+        int channel;
+    };
+    const auto split = (channelPolicy_ == ChannelPolicy::ChunkSplit);
+    auto sends = std::vector<SendOp>();
+    for (auto src = 0; src < topology_.npusCount(); src++) {
+        for (const auto& [dest, link] : synthesisResult_.npu(src).egressLinks()) {
+            for (const auto& [opId, op] : link.ops()) {
+                rank(matchingRecv.at(&op));
+                sends.push_back({&op, src, &link, split ? 0 : opId % channelsCount_});
+            }
+        }
+    }
+
+    // a send is ranked by its matching recv, which may wait for more than the send
+    const auto sendRank = [&](const SendOp& send) {
+        return ranks.at(matchingRecv.at(send.op));
+    };
+    const auto key = [&](const SendOp& send) {
+        return std::make_tuple(send.op->time(), sendRank(send), send.src, send.op->linkId(),
+                               send.op->opId());
+    };
+    std::sort(sends.begin(), sends.end(),
+              [&](const SendOp& lhs, const SendOp& rhs) { return key(lhs) < key(rhs); });
+
+    // sweep the sends in order, appending each one to the open group of its link channel
+    // if its chunk is contiguous and it waits for the same group (if any)
+    // a group is sealed as soon as a send depends on it, so every group completes before
+    // the last op of any group depending on it: ordering groups by their last op is then
+    // consistent with all dependencies and with the op order of every link
+    const auto coalesce = coalesceSteps_ && !split && !collective_.reduction();
+    groups_.clear();
+    opGroups_.clear();
+    auto openGroups = std::map<std::pair<const LinkResult*, int>, int>();
+    const auto depGroup = [&](const CommOp& op) {
+        return op.hasDep() ? group(*op.depOp()) : -1;
+    };
+    const auto sendsCount = static_cast<int>(sends.size());
+    for (auto begin = 0; begin < sendsCount;) {
+        auto end = begin;
+        while (end < sendsCount && sends[end].op->time() == sends[begin].op->time() &&
+               sendRank(sends[end]) == sendRank(sends[begin])) {
+            end++;
+        }
+
+        // seal first, so that no group grows alongside a send of the same rank depending on it
+        for (auto i = begin; i < end; i++) {
+            const auto dep = depGroup(*sends[i].op);
+            if (dep >= 0) {
+                opGroups_[dep].sealed = true;
+            }
+        }
+
+        for (auto i = begin; i < end; i++) {
+            const auto& send = sends[i];
+            const auto dep = depGroup(*send.op);
+            const auto open = openGroups.find({send.link, send.channel});
+            if (coalesce && open != openGroups.end()) {
+                auto& opGroup = opGroups_[open->second];
+                const auto contiguous = (send.op->chunkId() == opGroup.last->chunkId() + 1);
+                const auto compatible =
+                    (dep < 0 || opGroup.depGroup < 0 || dep == opGroup.depGroup);
+                if (!opGroup.sealed && contiguous && compatible) {
+                    opGroup.last = send.op;
+                    opGroup.depGroup = std::max(opGroup.depGroup, dep);
+                    groups_[send.op] = open->second;
+                    continue;
+                }
+            }
+
+            const auto id = static_cast<int>(opGroups_.size());
+            opGroups_.push_back({send.op, send.op, dep, false, -1});
+            groups_[send.op] = id;
+            openGroups[{send.link, send.channel}] = id;
+        }
+        begin = end;
+    }
+
+    // order the groups by their last op
+    auto position = std::unordered_map<const CommOp*, int>();
+    for (auto i = 0; i < sendsCount; i++) {
+        position[sends[i].op] = i;
+    }
+    for (auto& opGroup : opGroups_) {
+        opGroup.order = position.at(opGroup.last);
     }
 }
 
-void XmlWriter::writeIngressLink(pugi::xml_node& gpu, NpuID npu, NpuID src, const LinkResult& link) noexcept {
-    auto tb = gpu.append_child("tb");
-    tb.append_attribute("id") = link.id();
-    tb.append_attribute("send") = -1;
-    tb.append_attribute("recv") = src;
-    tb.append_attribute("chan") = 0;
-    for (const auto& [opId, op] : link.ops()) {
-        const auto chunkId = op.chunkId();
-        auto step = tb.append_child("step");
-        step.append_attribute("s") = opId;
-        step.append_attribute("type") = "r";
-        step.append_attribute("srcbuf") = "o";
-        step.append_attribute("srcoff") = chunkId;
-        step.append_attribute("dstbuf") = "o";
-        step.append_attribute("dstoff") = chunkId;
-        step.append_attribute("cnt") = 1;
-        step.append_attribute("depid") = -1;
-        step.append_attribute("deps") = -1;
-        step.append_attribute("hasdep") = op.depended() ? 1 : 0;
+int XmlWriter::group(const CommOp& op) const noexcept {
+    const auto send = matchingSend_.find(&op);
+    return groups_.at(send != matchingSend_.end() ? send->second : &op);
+}
+
+std::vector<XmlWriter::Threadblock> XmlWriter::assignChannels(const NpuID npuId) const noexcept {
+    auto& npu = synthesisResult_.npu(npuId);
+    const auto split = (channelPolicy_ == ChannelPolicy::ChunkSplit);
+
+    // each link gets one threadblock per channel, at index (link ID * channelsCount + channel)
+    // both ends of a link record its ops in the same order,
+    // so dealing ops by their order keeps matching send and recv threadblocks consistent
+    auto threadblocks = std::vector<Threadblock>();
+    const auto carries = [&](const int opIndex, const int channel) {
+        return split || (opIndex % channelsCount_ == channel);
+    };
+    const auto offset = [&](const ChunkID chunk, const int channel) {
+        return split ? (chunk * channelsCount_) + channel : chunk;
+    };
+
+    // location of each recv op: recvSteps[link ID][op ID] = (channel, step index)
+    auto recvSteps = std::map<LinkResult::LinkID, std::vector<std::pair<int, int>>>();
+
+    // a send depends on the recv of the same (sub-)chunk (and a recv reducing a chunk
+    // on the previous recv of the chunk), which may have been dealt to another channel
+    // of its ingress link
+    const auto dependency = [&](const CommOp& op, const int channel) {
+        if (!op.hasDep()) {
+            return std::make_pair(-1, -1);
+        }
+        const auto* const depOp = op.depOp();
+        const auto [depChannel, step] = recvSteps.at(depOp->linkId())[depOp->opId()];
+        const auto depTb = (depOp->linkId() * channelsCount_) + (split ? channel : depChannel);
+        return std::make_pair(depTb, step);
+    };
+
+    for (const auto& [src, link] : npu.ingressLinks()) {
+        const auto firstTb = link.id() * channelsCount_;
+        assert(static_cast<int>(threadblocks.size()) == firstTb);
+        for (auto channel = 0; channel < channelsCount_; channel++) {
+            threadblocks.push_back({-1, src, channel, {}});
+        }
+
+        auto& steps = recvSteps[link.id()];
+        steps.resize(link.ops().size(), {-1, -1});
+        for (const auto& [opId, op] : link.ops()) {
+            const auto chunkId = op.chunkId();
+            for (auto channel = 0; channel < channelsCount_; channel++) {
+                if (!carries(opId, channel)) {
+                    continue;
+                }
+                auto& tb = threadblocks[firstTb + channel];
+                const auto& opGroup = opGroups_[group(op)];
+                if (opGroup.first != matchingSend_.at(&op)) {
+                    // coalesced into the last step of the threadblock
+                    auto& step = tb.steps.back();
+                    step.count++;
+                    step.depended |= op.depended();
+                    steps[opId] = {channel, static_cast<int>(tb.steps.size()) - 1};
+                    continue;
+                }
+                steps[opId] = {channel, static_cast<int>(tb.steps.size())};
+                const auto* const type = op.reduction() ? "rrc" : "r";
+                tb.steps.push_back({type, offset(chunkId, channel), 1, -1, -1, op.depended(),
+                                    opGroup.order});
+            }
+        }
+    }
+
+    // once every recv has its step, link the recvs reducing a chunk to their dependency
+    for (const auto& [src, link] : npu.ingressLinks()) {
+        for (const auto& [opId, op] : link.ops()) {
+            for (auto channel = 0; channel < channelsCount_; channel++) {
+                if (!carries(opId, channel) || !op.hasDep()) {
+                    continue;
+                }
+                const auto [stepChannel, step] = recvSteps.at(link.id())[opId];
+                auto& recvStep =
+                    threadblocks[(link.id() * channelsCount_) + channel].steps[step];
+                std::tie(recvStep.depTb, recvStep.depStep) = dependency(op, channel);
+            }
+        }
     }
+
+    for (const auto& [dest, link] : npu.egressLinks()) {
+        const auto firstTb = link.id() * channelsCount_;
+        assert(static_cast<int>(threadblocks.size()) == firstTb);
+        for (auto channel = 0; channel < channelsCount_; channel++) {
+            threadblocks.push_back({dest, -1, channel, {}});
+        }
+
+        for (const auto& [opId, op] : link.ops()) {
+            const auto chunkId = op.chunkId();
+            for (auto channel = 0; channel < channelsCount_; channel++) {
+                if (!carries(opId, channel)) {
+                    continue;
+                }
+
+                const auto [depTb, depStep] = dependency(op, channel);
+
+                auto& tb = threadblocks[firstTb + channel];
+                const auto& opGroup = opGroups_[group(op)];
+                if (opGroup.first != &op) {
+                    // coalesced into the last step of the threadblock:
+                    // all sends of a group wait for the same recv step, if any
+                    auto& step = tb.steps.back();
+                    assert(depTb < 0 || step.depTb < 0 ||
+                           (step.depTb == depTb && step.depStep == depStep));
+                    step.count++;
+                    step.depended |= op.depended();
+                    if (step.depTb < 0) {
+                        step.depTb = depTb;
+                        step.depStep = depStep;
+                    }
+                    continue;
+                }
+                tb.steps.push_back({"s", offset(chunkId, channel), 1, depTb, depStep,
+                                    op.depended(), opGroup.order});
+            }
+        }
+    }
+
+    return threadblocks;
+}
+
+std::vector<XmlWriter::Threadblock> XmlWriter::fuseThreadblocks(
+    const NpuID npuId, const std::vector<Threadblock>& threadblocks) const noexcept {
+    const auto tbsCount = static_cast<int>(threadblocks.size());
+
+    // partner[tb] = threadblock to fuse with (-1 if none)
+    auto partner = std::vector<int>(tbsCount, -1);
+    auto fusedCount = tbsCount;
+
+    // for reductions, first pair every send-only threadblock with the recv-only threadblock
+    // (of the same channel) its steps depend on the most, so that partial chunks can be
+    // received, reduced, and sent on in single steps (see fuseReductions)
+    if (collective_.reduction()) {
+        for (auto tb = 0; tb < tbsCount; tb++) {
+            if (threadblocks[tb].recv >= 0) {
+                continue;
+            }
+            auto dependencies = std::map<int, int>();
+            for (const auto& step : threadblocks[tb].steps) {
+                const auto depTb = step.depTb;
+                if (depTb >= 0 && partner[depTb] < 0 && threadblocks[depTb].send < 0 &&
+                    threadblocks[depTb].channel == threadblocks[tb].channel) {
+                    dependencies[depTb]++;
+                }
+            }
+            auto best = dependencies.end();
+            for (auto it = dependencies.begin(); it != dependencies.end(); it++) {
+                if (best == dependencies.end() || it->second > best->second) {
+                    best = it;
+                }
+            }
+            if (best != dependencies.end()) {
+                partner[tb] = best->first;
+                partner[best->first] = tb;
+                fusedCount--;
+            }
+        }
+    }
+
+    // then, pair the recv-only and send-only threadblocks of the same peer and channel
+    auto recvOnly = std::map<std::pair<NpuID, int>, int>();
+    for (auto tb = 0; tb < tbsCount; tb++) {
+        if (threadblocks[tb].send < 0 && threadblocks[tb].recv >= 0 && partner[tb] < 0) {
+            recvOnly[{threadblocks[tb].recv, threadblocks[tb].channel}] = tb;
+        }
+    }
+    for (auto tb = 0; tb < tbsCount; tb++) {
+        if (threadblocks[tb].recv >= 0 || partner[tb] >= 0) {
+            continue;
+        }
+        const auto it = recvOnly.find({threadblocks[tb].send, threadblocks[tb].channel});
+        if (it != recvOnly.end()) {
+            partner[tb] = it->second;
+            partner[it->second] = tb;
+            fusedCount--;
+        }
+    }
+
+    // then, if still over the cap, pair the remaining recv-only and send-only threadblocks
+    // of the same channel, regardless of their peers
+    if (maxThreadblocks_ > 0 && fusedCount > maxThreadblocks_) {
+        auto unpairedRecvs = std::map<int, std::vector<int>>();
+        for (auto tb = 0; tb < tbsCount; tb++) {
+            if (partner[tb] < 0 && threadblocks[tb].send < 0) {
+                unpairedRecvs[threadblocks[tb].channel].push_back(tb);
+            }
+        }
+        for (auto tb = 0; tb < tbsCount && fusedCount > maxThreadblocks_; tb++) {
+            if (partner[tb] >= 0 || threadblocks[tb].recv >= 0) {
+                continue;
+            }
+            auto& recvs = unpairedRecvs[threadblocks[tb].channel];
+            if (recvs.empty()) {
+                continue;
+            }
+            partner[tb] = recvs.back();
+            partner[recvs.back()] = tb;
+            recvs.pop_back();
+            fusedCount--;
+        }
+
+        if (fusedCount > maxThreadblocks_) {
+            std::cerr << "GPU " << npuId << " needs " << fusedCount
+                      << " threadblocks, exceeding the cap of " << maxThreadblocks_ << std::endl;
+        }
+    }
+
+    // fuse the threadblocks: a fused threadblock takes the place of its first member
+    // steps are merged in their global execution order (see groupOps), which is consistent
+    // across all GPUs and respects every dependency, so fused threadblocks cannot deadlock
+    auto fused = std::vector<Threadblock>();
+    auto newTb = std::vector<int>(tbsCount, -1);
+    auto newStep = std::vector<std::vector<int>>(tbsCount);
+    const auto precedes = [](const Step& lhs, const Step& rhs) {
+        return lhs.order < rhs.order;
+    };
+
+    for (auto tb = 0; tb < tbsCount; tb++) {
+        const auto other = partner[tb];
+        if (other >= 0 && other < tb) {
+            // already fused with an earlier threadblock
+            continue;
+        }
+
+        const auto& first = threadblocks[tb];
+        newTb[tb] = static_cast<int>(fused.size());
+        newStep[tb].resize(first.steps.size());
+        if (other < 0) {
+            // nothing to fuse with
+            fused.push_back(first);
+            for (auto s = 0; s < static_cast<int>(first.steps.size()); s++) {
+                newStep[tb][s] = s;
+            }
+            continue;
+        }
+
+        const auto& second = threadblocks[other];
+        assert(first.channel == second.channel);
+        newTb[other] = newTb[tb];
+        newStep[other].resize(second.steps.size());
+
+        auto threadblock = Threadblock{std::max(first.send, second.send),
+                                       std::max(first.recv, second.recv), first.channel, {}};
+        const auto firstCount = static_cast<int>(first.steps.size());
+        const auto secondCount = static_cast<int>(second.steps.size());
+        auto i = 0;
+        auto j = 0;
+        while (i < firstCount || j < secondCount) {
+            const auto takeFirst =
+                (j >= secondCount) ||
+                (i < firstCount && precedes(first.steps[i], second.steps[j]));
+            if (takeFirst) {
+                newStep[tb][i] = static_cast<int>(threadblock.steps.size());
+                threadblock.steps.push_back(first.steps[i++]);
+            } else {
+                newStep[other][j] = static_cast<int>(threadblock.steps.size());
+                threadblock.steps.push_back(second.steps[j++]);
+            }
+        }
+        fused.push_back(std::move(threadblock));
+    }
+
+    // remap dependencies to the fused threadblocks and steps
+    for (auto& threadblock : fused) {
+        for (auto& step : threadblock.steps) {
+            if (step.depTb < 0) {
+                continue;
+            }
+            const auto depTb = step.depTb;
+            step.depTb = newTb[depTb];
+            step.depStep = newStep[depTb][step.depStep];
+        }
+    }
+
+    return fused;
+}
+
+std::vector<XmlWriter::Threadblock> XmlWriter::fuseReductions(
+    const std::vector<Threadblock>& threadblocks) const noexcept {
+    const auto tbsCount = static_cast<int>(threadblocks.size());
+
+    // number of steps depending on each step
+    auto dependents = std::map<std::pair<int, int>, int>();
+    for (const auto& threadblock : threadblocks) {
+        for (const auto& step : threadblock.steps) {
+            if (step.depTb >= 0) {
+                dependents[{step.depTb, step.depStep}]++;
+            }
+        }
+    }
+
+    // a recv-reduce step followed by the send of the same chunk, which only it depends on,
+    // makes a single recv-reduce-send step
+    auto fused = std::vector<Threadblock>();
+    auto newStep = std::vector<std::vector<int>>(tbsCount);
+    for (auto tb = 0; tb < tbsCount; tb++) {
+        const auto& steps = threadblocks[tb].steps;
+        const auto stepsCount = static_cast<int>(steps.size());
+        auto threadblock = Threadblock{threadblocks[tb].send, threadblocks[tb].recv,
+                                       threadblocks[tb].channel, {}};
+        newStep[tb].resize(stepsCount);
+        for (auto s = 0; s < stepsCount; s++) {
+            newStep[tb][s] = static_cast<int>(threadblock.steps.size());
+            threadblock.steps.push_back(steps[s]);
+            if (s + 1 == stepsCount || steps[s].type != "rrc") {
+                continue;
+            }
+            const auto& next = steps[s + 1];
+            const auto reducedAndSent = (next.type == "s" && next.depTb == tb &&
+                                         next.depStep == s && next.offset == steps[s].offset &&
+                                         next.count == steps[s].count);
+            if (reducedAndSent && dependents[{tb, s}] == 1) {
+                auto& step = threadblock.steps.back();
+                step.type = "rrs";
+                step.depended = next.depended;
+                newStep[tb][s + 1] = newStep[tb][s];
+                s++;
+            }
+        }
+        fused.push_back(std::move(threadblock));
+    }
+
+    // remap dependencies to the fused steps
+    for (auto& threadblock : fused) {
+        for (auto& step : threadblock.steps) {
+            if (step.depTb >= 0) {
+                step.depStep = newStep[step.depTb][step.depStep];
+            }
+        }
+    }
+
+    return fused;
 }
 
-void XmlWriter::writeEgressLink(pugi::xml_node& gpu, NpuID npu, NpuID dest, const LinkResult& link) noexcept {
+void XmlWriter::writeThreadblock(pugi::xml_node& gpu,
+                                 const int id,
+                                 const Threadblock& threadblock) noexcept {
     auto tb = gpu.append_child("tb");
-    tb.append_attribute("id") = link.id();
-    tb.append_attribute("send") = dest;
-    tb.append_attribute("recv") = -1;
-    tb.append_attribute("chan") = 0;
-    for (const auto& [opId, op] : link.ops()) {
-        const auto chunkId = op.chunkId();
-        auto step = tb.append_child("step");
-        step.append_attribute("s") = opId;
-        step.append_attribute("type") = "s";
-        step.append_attribute("srcbuf") = "o";
-        step.append_attribute("srcoff") = chunkId;
-        step.append_attribute("dstbuf") = "o";
-        step.append_attribute("dstoff") = chunkId;
-        step.append_attribute("cnt") = 1;
-        if (op.hasDep()) {
-            step.append_attribute("depid") = op.depOp()->linkId();
-            step.append_attribute("deps") = op.depOp()->opId();
-        } else {
-            step.append_attribute("depid") = -1;
-            step.append_attribute("deps") = -1;
-        }
-        step.append_attribute("hasdep") = op.depended() ? 1 : 0;
+    tb.append_attribute("id") = id;
+    tb.append_attribute("send") = threadblock.send;
+    tb.append_attribute("recv") = threadblock.recv;
+    tb.append_attribute("chan") = threadblock.channel;
+    const auto* const buffer = collective_.reduction() ? "i" : "o";
+    for (auto s = 0; s < static_cast<int>(threadblock.steps.size()); s++) {
+        const auto& step = threadblock.steps[s];
+        auto xmlStep = tb.append_child("step");
+        xmlStep.append_attribute("s") = s;
+        xmlStep.append_attribute("type") = step.type.c_str();
+        xmlStep.append_attribute("srcbuf") = buffer;
+        xmlStep.append_attribute("srcoff") = step.offset;
+        xmlStep.append_attribute("dstbuf") = buffer;
+        xmlStep.append_attribute("dstoff") = step.offset;
+        xmlStep.append_attribute("cnt") = step.count;
+        xmlStep.append_attribute("depid") = step.depTb;
+        xmlStep.append_attribute("deps") = step.depStep;
+        xmlStep.append_attribute("hasdep") = step.depended ? 1 : 0;
+    }
+}
+
+int XmlWriter::chunksPerLoop() const noexcept {
+    const auto chunksCount = collective_.chunksCount();
+    return (channelPolicy_ == ChannelPolicy::ChunkSplit) ? chunksCount * channelsCount_
+                                                          : chunksCount;
+}
+
+void XmlWriter::save() noexcept {
+    if (xml.save_file(path.c_str(), PUGIXML_TEXT("\t"), pugi::format_no_declaration)) {
+        std::cout << "XML file written at: " << path << std::endl;
+    } else {
+        std::cout << "XML file writing failed" << std::endl;
     }
 }
@@ -8,10 +8,44 @@ Copyright (c) 2022-2025 Georgia Institute of Technology
 
 #pragma once
 
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <tacos/writer/synthesis_result.h>
 
 class TestConfig : public ::testing::Test {
   protected:
     static constexpr double tolerance = 0.01;
     static constexpr int repeat = 20;
+
+    /// @brief Check that an all-gather schedule delivers every chunk once to every other NPU,
+    /// after it arrived at the source, and the last one at the collective time
+    /// (wrap in ASSERT_NO_FATAL_FAILURE to stop the test on failure)
+    /// @param strict false if a chunk may be forwarded at the time it arrives
+    /// (e.g., as a replacement chunk of the synthesizer)
+    static void checkAllGatherSchedule(tacos::SynthesisResult& synthesisResult,
+                                       const int npusCount,
+                                       const int chunksCount,
+                                       const bool strict = true) {
+        auto recvsCount = 0;
+        auto lastRecvTime = 0.0;
+        for (auto npu = 0; npu < npusCount; npu++) {
+            for (const auto& [dest, link] : synthesisResult.npu(npu).egressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    if (op.hasDep() && strict) {
+                        ASSERT_LT(op.depOp()->time(), op.time());
+                    } else if (op.hasDep()) {
+                        ASSERT_LE(op.depOp()->time(), op.time());
+                    }
+                }
+            }
+            for (const auto& [src, link] : synthesisResult.npu(npu).ingressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    recvsCount++;
+                    lastRecvTime = std::max(lastRecvTime, op.time());
+                }
+            }
+        }
+        ASSERT_EQ(recvsCount, chunksCount * (npusCount - 1));
+        ASSERT_DOUBLE_EQ(lastRecvTime, synthesisResult.collectiveTime());
+    }
 };
@@ -0,0 +1,130 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <pugixml.hpp>
+#include <string>
+#include <tacos/collective/all_reduce.h>
+#include <tacos/collective/reduce_scatter.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/hetero_mesh_2d.h>
+#include <tacos/writer/xml_writer.h>
+#include <test_config.h>
+#include <vector>
+
+using namespace tacos;
+
+TEST_F(TestConfig, AllReduceHeteroMesh2D) {
+    const auto topology = HeteroMesh2D(3, 3, 50.0, 0.5, 25.0, 1.0);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllReduce(npusCount, 2);
+    const auto chunksCount = collective.chunksCount();
+    const auto chunkSize = int64_t(1 << 20);
+    ASSERT_TRUE(collective.reduction());
+    ASSERT_TRUE(collective.gathered());
+
+    auto overlapsCount = 0;
+    for (int i = 0; i < repeat; ++i) {
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+
+        // every partial chunk is reduced into its owner,
+        // and the reduced chunk gathered back once to every other NPU
+        auto reducedTimes = std::vector<double>(chunksCount, 0);
+        auto lastReducedTime = 0.0;
+        auto gathersCount = std::vector<int>(chunksCount * npusCount, 0);
+        for (auto npu = 0; npu < npusCount; npu++) {
+            for (const auto& [src, link] : synthesisResult.npu(npu).ingressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    const auto chunk = op.chunkId();
+                    if (op.reduction()) {
+                        if (npu == collective.precondition(chunk)) {
+                            reducedTimes[chunk] = std::max(reducedTimes[chunk], op.time());
+                        }
+                        lastReducedTime = std::max(lastReducedTime, op.time());
+                    } else {
+                        gathersCount[chunk * npusCount + npu]++;
+                    }
+                }
+            }
+        }
+        for (auto chunk = 0; chunk < chunksCount; chunk++) {
+            for (auto npu = 0; npu < npusCount; npu++) {
+                const auto gathered = (npu == collective.precondition(chunk)) ? 0 : 1;
+                ASSERT_EQ(gathersCount[chunk * npusCount + npu], gathered);
+            }
+        }
+
+        // a chunk is gathered back once reduced, but not necessarily after all the others
+        auto firstGatheredTime = synthesisResult.collectiveTime();
+        for (auto npu = 0; npu < npusCount; npu++) {
+            for (const auto& [src, link] : synthesisResult.npu(npu).ingressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    if (!op.reduction()) {
+                        ASSERT_GT(op.time(), reducedTimes[op.chunkId()]);
+                        firstGatheredTime = std::min(firstGatheredTime, op.time());
+                    }
+                }
+            }
+        }
+        overlapsCount += (firstGatheredTime < lastReducedTime);
+
+        // the reduction phase alone is the reduce-scatter of the same dual schedule
+        auto reduceScatterSynthesizer = Synthesizer();
+        reduceScatterSynthesizer.seed(i);
+        const auto reduceScatterResult =
+            reduceScatterSynthesizer.solve(topology, ReduceScatter(npusCount, 2), chunkSize);
+        ASSERT_DOUBLE_EQ(lastReducedTime, reduceScatterResult.collectiveTime());
+    }
+    ASSERT_GT(overlapsCount, 0);
+}
+
+TEST_F(TestConfig, AllReduceXmlWriter) {
+    const auto topology = HeteroMesh2D(3, 3, 50.0, 0.5, 25.0, 1.0);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllReduce(npusCount, 2);
+    const auto chunkSize = int64_t(1 << 20);
+
+    auto synthesizer = Synthesizer();
+    auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+
+    const auto path = (std::filesystem::temp_directory_path() / "tacos_ar.xml").string();
+    auto writer = XmlWriter(path, topology, collective, synthesisResult);
+    writer.write();
+
+    auto doc = pugi::xml_document();
+    ASSERT_TRUE(doc.load_file(path.c_str()));
+    const auto algo = doc.child("algo");
+    ASSERT_STREQ(algo.attribute("coll").value(), "allreduce");
+    const auto chunksPerLoop = algo.attribute("nchunksperloop").as_int();
+
+    // every NPU reduces the partial chunks of the others into its chunks (rrc),
+    // and receives the reduced chunks of the others (r)
+    auto reducedCount = 0;
+    auto gatheredCount = 0;
+    for (const auto gpu : algo.children("gpu")) {
+        ASSERT_EQ(gpu.attribute("i_chunks").as_int(), chunksPerLoop);
+        ASSERT_EQ(gpu.attribute("o_chunks").as_int(), chunksPerLoop);
+        for (const auto tb : gpu.children("tb")) {
+            for (const auto step : tb.children("step")) {
+                const auto type = std::string(step.attribute("type").value());
+                reducedCount += (type == "rrc");
+                gatheredCount += (type == "r");
+            }
+        }
+    }
+    const auto transfersCount = collective.chunksCount() * (npusCount - 1);
+    ASSERT_EQ(reducedCount, transfersCount);
+    ASSERT_EQ(gatheredCount, transfersCount);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,110 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <tacos/collective/all_gather.h>
+#include <tacos/collective/all_to_all.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/synthesizer/time_expanded_network.h>
+#include <tacos/topology/mesh_2d.h>
+#include <test_config.h>
+#include <vector>
+
+using namespace tacos;
+
+TEST_F(TestConfig, AllToAllMesh2D) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllToAll(npusCount, 2);
+    const auto chunksCount = collective.chunksCount();
+    const auto chunkSize = int64_t(1 << 20);
+    ASSERT_EQ(chunksCount, npusCount * (npusCount - 1) * 2);
+    ASSERT_FALSE(collective.sized());
+
+    for (int i = 0; i < repeat; ++i) {
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+
+        // every chunk reaches its destination, relayed through the NPUs on the way,
+        // and the collective ends with the last arrival at a destination
+        auto arrivals = std::vector<int>(chunksCount, 0);
+        auto lastArrivalTime = 0.0;
+        for (auto npu = 0; npu < npusCount; npu++) {
+            for (const auto& [src, link] : synthesisResult.npu(npu).ingressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    if (collective.postcondition(op.chunkId()).count(npu) > 0) {
+                        arrivals[op.chunkId()]++;
+                        lastArrivalTime = std::max(lastArrivalTime, op.time());
+                    }
+                }
+            }
+        }
+        for (auto chunk = 0; chunk < chunksCount; chunk++) {
+            ASSERT_EQ(arrivals[chunk], 1);
+        }
+        ASSERT_DOUBLE_EQ(synthesisResult.collectiveTime(), lastArrivalTime);
+    }
+}
+
+TEST_F(TestConfig, AllToAllvChunkSizes) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto chunkSize = int64_t(1 << 20);
+    const auto ten = TimeExpandedNetwork(topology, chunkSize);
+
+    // NPU 0 sends 4x larger chunks, and nothing to NPU 1
+    auto sizes = std::vector<std::vector<int64_t>>(npusCount,
+                                                   std::vector<int64_t>(npusCount, chunkSize));
+    sizes[0] = std::vector<int64_t>(npusCount, chunkSize * 4);
+    sizes[0][1] = 0;
+    const auto collective = AllToAllv(sizes);
+    ASSERT_TRUE(collective.sized());
+    ASSERT_EQ(collective.chunksCount(), npusCount * (npusCount - 1) - 1);
+    for (auto chunk = 0; chunk < collective.chunksCount(); chunk++) {
+        const auto src = collective.precondition(chunk);
+        ASSERT_EQ(collective.size(chunk), src == 0 ? chunkSize * 4 : chunkSize);
+    }
+
+    const auto uniform = AllToAll(npusCount);
+    for (int i = 0; i < repeat; ++i) {
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+
+        // every transfer takes at least the link time of its own chunk size
+        for (auto npu = 0; npu < npusCount; npu++) {
+            for (const auto& [src, link] : synthesisResult.npu(npu).ingressLinks()) {
+                const auto& ops = link.ops();
+                auto linkFreeTime = 0.0;
+                for (const auto& [opId, op] : ops) {
+                    const auto size = collective.size(op.chunkId());
+                    const auto startTime = op.time() - ten.linkTransferTime(src, npu, size);
+                    ASSERT_GE(startTime + 1e-9, linkFreeTime);
+                    linkFreeTime = op.time();
+                }
+            }
+        }
+
+        // larger chunks take longer than the uniform AllToAll
+        auto uniformSynthesizer = Synthesizer();
+        uniformSynthesizer.seed(i);
+        const auto uniformResult = uniformSynthesizer.solve(topology, uniform, chunkSize);
+        ASSERT_GT(synthesisResult.collectiveTime(), uniformResult.collectiveTime());
+    }
+}
+
+TEST_F(TestConfig, AllGatherNotSized) {
+    const auto collective = AllGather(4, 2);
+    ASSERT_FALSE(collective.sized());
+    for (auto chunk = 0; chunk < collective.chunksCount(); chunk++) {
+        ASSERT_EQ(collective.size(chunk), 0);
+    }
+}
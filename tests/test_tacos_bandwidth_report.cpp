@@ -0,0 +1,116 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <tacos/collective/all_gather.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/mesh_2d.h>
+#include <tacos/writer/bandwidth_report.h>
+#include <test_config.h>
+
+using namespace tacos;
+
+TEST_F(TestConfig, BandwidthReportFactors) {
+    using CollectiveType = BandwidthReport::CollectiveType;
+    const auto npusCount = 8;
+
+    ASSERT_DOUBLE_EQ(BandwidthReport::busBandwidthFactor(CollectiveType::AllGather, npusCount),
+                     7.0 / 8.0);
+    ASSERT_DOUBLE_EQ(
+        BandwidthReport::busBandwidthFactor(CollectiveType::ReduceScatter, npusCount), 7.0 / 8.0);
+    ASSERT_DOUBLE_EQ(BandwidthReport::busBandwidthFactor(CollectiveType::AllReduce, npusCount),
+                     14.0 / 8.0);
+    ASSERT_DOUBLE_EQ(BandwidthReport::busBandwidthFactor(CollectiveType::AllToAll, npusCount),
+                     7.0 / 8.0);
+    ASSERT_DOUBLE_EQ(BandwidthReport::busBandwidthFactor(CollectiveType::Broadcast, npusCount),
+                     1.0);
+    ASSERT_DOUBLE_EQ(BandwidthReport::busBandwidthFactor(CollectiveType::Reduce, npusCount), 1.0);
+}
+
+TEST_F(TestConfig, BandwidthReportAllGather) {
+    const auto topology = Mesh2D(2, 2, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 2);
+    const auto chunksCount = collective.chunksCount();
+
+    auto report = BandwidthReport(BandwidthReport::CollectiveType::AllGather, npusCount);
+    auto synthesizer = Synthesizer();
+    auto sizesCount = 0;
+    for (auto chunkSize = int64_t(1 << 16); chunkSize <= (1 << 20); chunkSize *= 4) {
+        const auto collectiveTime =
+            synthesizer.solve(topology, collective, chunkSize).collectiveTime();
+        report.add(chunkSize * chunksCount, collectiveTime);
+
+        // 1 byte/us = 1e-3 GB/s
+        const auto algbw = static_cast<double>(chunkSize * chunksCount) / collectiveTime / 1e3;
+        ASSERT_DOUBLE_EQ(report.algorithmBandwidth(sizesCount), algbw);
+        ASSERT_DOUBLE_EQ(report.busBandwidth(sizesCount), algbw * (npusCount - 1) / npusCount);
+        sizesCount++;
+    }
+
+    // one table row per size, in the nccl-tests layout
+    auto table = std::ostringstream();
+    report.print(table);
+    auto rowsCount = 0;
+    auto line = std::string();
+    auto tableStream = std::istringstream(table.str());
+    while (std::getline(tableStream, line)) {
+        if (!line.empty() && line[0] != '#') {
+            ASSERT_NE(line.find("float"), std::string::npos);
+            rowsCount++;
+        }
+    }
+    ASSERT_EQ(rowsCount, sizesCount);
+
+    // header and one CSV line per size
+    const auto path = (std::filesystem::temp_directory_path() / "tacos_bandwidth.csv").string();
+    ASSERT_TRUE(report.writeCsv(path));
+    auto csv = std::ifstream(path);
+    auto csvLines = 0;
+    while (std::getline(csv, line)) {
+        csvLines++;
+    }
+    ASSERT_EQ(csvLines, sizesCount + 1);
+    std::filesystem::remove(path);
+}
+
+TEST_F(TestConfig, BandwidthReportRoot) {
+    using CollectiveType = BandwidthReport::CollectiveType;
+    const auto npusCount = 8;
+    const auto root = 3;
+
+    // rooted collectives report their root, rootless ones -1
+    const auto path = (std::filesystem::temp_directory_path() / "tacos_bandwidth.csv").string();
+    for (const auto [type, expected] : {std::pair(CollectiveType::Broadcast, "3"),
+                                        std::pair(CollectiveType::Reduce, "3"),
+                                        std::pair(CollectiveType::AllGather, "-1")}) {
+        auto report = BandwidthReport(type, npusCount, root);
+        report.add(1 << 20, 100.0);
+        ASSERT_TRUE(report.writeCsv(path));
+
+        auto csv = std::ifstream(path);
+        auto line = std::string();
+        ASSERT_TRUE(std::getline(csv, line));
+        ASSERT_TRUE(std::getline(csv, line));
+
+        // root is the fifth column
+        auto cells = std::istringstream(line);
+        auto cell = std::string();
+        for (auto column = 0; column < 5; column++) {
+            ASSERT_TRUE(std::getline(cells, cell, ','));
+        }
+        ASSERT_EQ(cell, expected);
+    }
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,60 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <tacos/collective/all_gather.h>
+#include <tacos/synthesizer/chunk_tuner.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/mesh_2d_hetero.h>
+#include <test_config.h>
+
+using namespace tacos;
+
+TEST_F(TestConfig, BeamSearchSchedule) {
+    const auto topology = Mesh2D_Hetero(4, 4, 100.0, 0.5, 25.0, 1.0);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 2);
+    const auto chunkSize = int64_t(1 << 20);
+
+    auto synthesizer = Synthesizer();
+    synthesizer.beamSearch(4);
+    auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+    const auto collectiveTime = synthesisResult.collectiveTime();
+    ASSERT_GE(collectiveTime, ChunkTuner::lowerBound(topology, collective, chunkSize));
+
+    // the replayed schedule is a valid all-gather schedule
+    ASSERT_NO_FATAL_FAILURE(
+        checkAllGatherSchedule(synthesisResult, npusCount, collective.chunksCount(), false));
+}
+
+TEST_F(TestConfig, BeamSearchMesh2DHetero) {
+    const auto topology = Mesh2D_Hetero(4, 4, 100.0, 0.5, 25.0, 1.0);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 2);
+    const auto chunkSize = int64_t(1 << 20);
+
+    // a single randomized pass
+    auto synthesizer = Synthesizer();
+    auto randomTime = 0.0;
+    for (int i = 0; i < repeat; ++i) {
+        randomTime += synthesizer.solve(topology, collective, chunkSize).collectiveTime();
+    }
+    randomTime /= repeat;
+
+    // the beam search keeps the most promising of many partial schedules
+    synthesizer.beamSearch(16);
+    const auto beamRepeat = 3;
+    auto beamTime = 0.0;
+    for (int i = 0; i < beamRepeat; ++i) {
+        beamTime += synthesizer.solve(topology, collective, chunkSize).collectiveTime();
+    }
+    beamTime /= beamRepeat;
+
+    ASSERT_LE(beamTime, randomTime * (1 + tolerance));
+}
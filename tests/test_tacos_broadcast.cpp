@@ -0,0 +1,117 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cstdint>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <pugixml.hpp>
+#include <string>
+#include <tacos/collective/broadcast.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/synthesizer/time_expanded_network.h>
+#include <tacos/topology/hetero_mesh_3d.h>
+#include <tacos/topology/torus_3d.h>
+#include <tacos/writer/xml_writer.h>
+#include <test_config.h>
+#include <vector>
+
+using namespace tacos;
+
+TEST_F(TestConfig, BroadcastTorus3D) {
+    const auto topology = Torus3D(3, 3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto chunkSize = int64_t(1 << 20);
+    const auto chunksCount = 24;
+    const auto root = 13;
+    const auto collective = Broadcast(npusCount, chunksCount, root);
+    const auto linkTime = TimeExpandedNetwork(topology, chunkSize).linkTransferTime(0, 1);
+
+    for (int i = 0; i < repeat; ++i) {
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+
+        // every NPU but the root receives every chunk exactly once
+        auto recvsCount = std::vector<int>(chunksCount * npusCount, 0);
+        for (auto npu = 0; npu < npusCount; npu++) {
+            for (const auto& [src, link] : synthesisResult.npu(npu).ingressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    recvsCount[op.chunkId() * npusCount + npu]++;
+                }
+            }
+        }
+        for (auto chunk = 0; chunk < chunksCount; chunk++) {
+            ASSERT_EQ(collective.precondition(chunk), root);
+            for (auto npu = 0; npu < npusCount; npu++) {
+                ASSERT_EQ(recvsCount[chunk * npusCount + npu], npu == root ? 0 : 1);
+            }
+        }
+
+        // the chunks leave the root over all its links, down pipelined trees,
+        // well ahead of a pipelined ring
+        ASSERT_EQ(synthesisResult.npu(root).egressLinks().size(), 6);
+        const auto ringTime = (chunksCount + npusCount - 2) * linkTime;
+        ASSERT_LT(synthesisResult.collectiveTime() * 2, ringTime);
+    }
+}
+
+TEST_F(TestConfig, ReduceHeteroMesh3D) {
+    const auto topology = HeteroMesh3D(2, 2, 2, 50.0, 0.5, 50.0, 0.5, 25.0, 1.0);
+    const auto npusCount = topology.npusCount();
+    const auto chunkSize = int64_t(1 << 20);
+    const auto chunksCount = 8;
+    const auto root = 3;
+    const auto collective = Reduce(npusCount, chunksCount, root);
+    ASSERT_TRUE(collective.reduction());
+
+    for (int i = 0; i < repeat; ++i) {
+        // reducing into the root mirrors broadcasting from it
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+        auto broadcastSynthesizer = Synthesizer();
+        broadcastSynthesizer.seed(i);
+        const auto broadcastResult = broadcastSynthesizer.solve(
+            topology, Broadcast(npusCount, chunksCount, root), chunkSize);
+        ASSERT_DOUBLE_EQ(synthesisResult.collectiveTime(), broadcastResult.collectiveTime());
+
+        // every NPU but the root sends every partial chunk exactly once
+        auto sendsCount = std::vector<int>(chunksCount * npusCount, 0);
+        for (auto npu = 0; npu < npusCount; npu++) {
+            for (const auto& [dest, link] : synthesisResult.npu(npu).egressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    sendsCount[op.chunkId() * npusCount + npu]++;
+                }
+            }
+        }
+        for (auto chunk = 0; chunk < chunksCount; chunk++) {
+            for (auto npu = 0; npu < npusCount; npu++) {
+                ASSERT_EQ(sendsCount[chunk * npusCount + npu], npu == root ? 0 : 1);
+            }
+        }
+    }
+
+    // only the root holds reduced chunks in its output buffer
+    auto synthesizer = Synthesizer();
+    auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+    const auto path = (std::filesystem::temp_directory_path() / "tacos_reduce.xml").string();
+    auto writer = XmlWriter(path, topology, collective, synthesisResult);
+    writer.write();
+
+    auto doc = pugi::xml_document();
+    ASSERT_TRUE(doc.load_file(path.c_str()));
+    const auto algo = doc.child("algo");
+    ASSERT_STREQ(algo.attribute("coll").value(), "reduce");
+    for (const auto gpu : algo.children("gpu")) {
+        const auto owned = (gpu.attribute("id").as_int() == root) ? chunksCount : 0;
+        ASSERT_EQ(gpu.attribute("i_chunks").as_int(), chunksCount);
+        ASSERT_EQ(gpu.attribute("o_chunks").as_int(), owned);
+    }
+
+    std::filesystem::remove(path);
+}
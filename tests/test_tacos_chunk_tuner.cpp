@@ -0,0 +1,89 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <tacos/collective/all_gather.h>
+#include <tacos/collective/all_to_all.h>
+#include <tacos/synthesizer/chunk_tuner.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/hetero_mesh_2d.h>
+#include <tacos/topology/mesh_2d.h>
+#include <test_config.h>
+#include <vector>
+
+using namespace tacos;
+
+TEST_F(TestConfig, ChunkTunerLowerBound) {
+    const auto topology = HeteroMesh2D(3, 3, 100.0, 1.0, 25.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    auto synthesizer = Synthesizer();
+
+    // no synthesized algorithm beats the lower bound
+    for (auto collectivesCount = 1; collectivesCount <= 4; collectivesCount++) {
+        const auto collective = AllGather(npusCount, collectivesCount);
+        for (auto chunkSize = int64_t(1 << 10); chunkSize <= (1 << 22); chunkSize *= 16) {
+            const auto bound = ChunkTuner::lowerBound(topology, collective, chunkSize);
+            const auto collectiveTime =
+                synthesizer.solve(topology, collective, chunkSize).collectiveTime();
+            ASSERT_GT(bound, 0);
+            ASSERT_LE(bound, collectiveTime * (1 + tolerance));
+        }
+    }
+}
+
+TEST_F(TestConfig, ChunkTunerLowerBoundSized) {
+    const auto topology = HeteroMesh2D(3, 3, 100.0, 1.0, 25.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    auto synthesizer = Synthesizer();
+
+    // chunks far larger than the chunk size the collective is synthesized with
+    auto sizes = std::vector<std::vector<int64_t>>(npusCount, std::vector<int64_t>(npusCount));
+    for (auto src = 0; src < npusCount; src++) {
+        for (auto dest = 0; dest < npusCount; dest++) {
+            sizes[src][dest] = int64_t(1 << 20) * (1 + (src + dest) % 4);
+        }
+    }
+    const auto collective = AllToAllv(sizes);
+    for (auto chunkSize = int64_t(1 << 10); chunkSize <= (1 << 22); chunkSize *= 16) {
+        const auto bound = ChunkTuner::lowerBound(topology, collective, chunkSize);
+        const auto collectiveTime =
+            synthesizer.solve(topology, collective, chunkSize).collectiveTime();
+        ASSERT_GT(bound, 0);
+        ASSERT_LE(bound, collectiveTime * (1 + tolerance));
+    }
+}
+
+TEST_F(TestConfig, ChunkTunerMesh3x3) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto bufferSize = int64_t(64 << 20);  // 64 MiB
+    const auto maxCollectivesCount = 8;
+
+    const auto factory = [npusCount](const int collectivesCount) {
+        return std::make_unique<AllGather>(npusCount, collectivesCount);
+    };
+    const auto tuner = ChunkTuner(maxCollectivesCount, 10000.0);
+    const auto result = tuner.tune(topology, factory, bufferSize);
+    ASSERT_TRUE(result.has_value());
+
+    ASSERT_GE(result->collectivesCount, 1);
+    ASSERT_LE(result->collectivesCount, maxCollectivesCount);
+    ASSERT_EQ(result->unfinishedCount, 0);
+    ASSERT_EQ(result->synthesizedCount + result->prunedCount, maxCollectivesCount);
+
+    // on a homogeneous mesh, the bound is tight enough to skip most chunk counts
+    ASSERT_GT(result->prunedCount, 0);
+
+    // the tuned chunk count respects the lower bound
+    const auto collective = AllGather(npusCount, result->collectivesCount);
+    const auto chunkSize = bufferSize / collective.chunksCount();
+    const auto bound = ChunkTuner::lowerBound(topology, collective, chunkSize);
+    ASSERT_LE(bound, result->collectiveTime * (1 + tolerance));
+}
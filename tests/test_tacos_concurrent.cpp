@@ -0,0 +1,178 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <tacos/collective/all_gather.h>
+#include <tacos/collective/all_reduce.h>
+#include <tacos/collective/concurrent_collective.h>
+#include <tacos/collective/reduce_scatter.h>
+#include <tacos/synthesizer/concurrent_synthesizer.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/mesh_2d.h>
+#include <test_config.h>
+#include <vector>
+
+using namespace tacos;
+
+TEST_F(TestConfig, ConcurrentAllGatherMesh2D) {
+    const auto topology = Mesh2D(4, 4, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto chunkSize = int64_t(1 << 20);
+
+    // tensor-parallel all-gathers along every row, data-parallel all-gathers along every column
+    auto collective = ConcurrentCollective();
+    for (auto row = 0; row < 4; row++) {
+        ASSERT_EQ(collective.add(AllGather(4, 2), {row * 4, row * 4 + 1, row * 4 + 2, row * 4 + 3}),
+                  row);
+    }
+    for (auto column = 0; column < 4; column++) {
+        collective.add(AllGather(4), {column, column + 4, column + 8, column + 12});
+    }
+    ASSERT_EQ(collective.groupsCount(), 8);
+    ASSERT_EQ(collective.chunksCount(), 4 * 8 + 4 * 4);
+    ASSERT_EQ(collective.firstChunk(4), 32);
+    ASSERT_EQ(collective.group(31), 3);
+    ASSERT_EQ(collective.member(1).precondition(1), 5);
+    ASSERT_EQ(collective.member(5).postcondition(0).count(13), 1);
+
+    for (int i = 0; i < repeat; ++i) {
+        auto concurrentSynthesizer = ConcurrentSynthesizer();
+        concurrentSynthesizer.synthesizer().seed(i);
+        auto result = concurrentSynthesizer.solve(topology, collective, chunkSize);
+
+        // the groups are split out of the joint schedule
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        const auto jointResult = synthesizer.solve(topology, collective, chunkSize);
+        ASSERT_DOUBLE_EQ(result.makespan, jointResult.collectiveTime());
+
+        for (auto group = 0; group < collective.groupsCount(); group++) {
+            const auto& member = collective.member(group);
+            auto& synthesisResult = result.synthesisResults[group];
+
+            // every member NPU receives every chunk of its group once,
+            // and the group completes with its last arrival
+            auto arrivals = std::vector<int>(member.chunksCount() * npusCount, 0);
+            auto lastArrivalTime = 0.0;
+            for (auto npu = 0; npu < npusCount; npu++) {
+                for (const auto& [src, link] : synthesisResult.npu(npu).ingressLinks()) {
+                    for (const auto& [opId, op] : link.ops()) {
+                        arrivals[op.chunkId() * npusCount + npu]++;
+                        lastArrivalTime = std::max(lastArrivalTime, op.time());
+                    }
+                }
+            }
+            for (auto chunk = 0; chunk < member.chunksCount(); chunk++) {
+                for (const auto npu : member.postcondition(chunk)) {
+                    const auto held = (npu == member.precondition(chunk));
+                    ASSERT_EQ(arrivals[chunk * npusCount + npu], held ? 0 : 1);
+                }
+            }
+            ASSERT_DOUBLE_EQ(result.completionTimes[group], lastArrivalTime);
+            ASSERT_DOUBLE_EQ(synthesisResult.collectiveTime(), lastArrivalTime);
+        }
+    }
+}
+
+TEST_F(TestConfig, ConcurrentContention) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto chunkSize = int64_t(1 << 20);
+    auto npus = std::vector<Collective::NpuID>();
+    for (auto npu = 0; npu < npusCount; npu++) {
+        npus.push_back(npu);
+    }
+
+    // two all-gathers over the same NPUs share the links, and thus take longer than one alone
+    auto collective = ConcurrentCollective();
+    collective.add(AllGather(npusCount), npus);
+    collective.add(AllGather(npusCount), npus);
+    for (int i = 0; i < repeat; ++i) {
+        auto concurrentSynthesizer = ConcurrentSynthesizer();
+        concurrentSynthesizer.synthesizer().seed(i);
+        const auto result = concurrentSynthesizer.solve(topology, collective, chunkSize);
+
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        const auto isolatedResult = synthesizer.solve(topology, AllGather(npusCount), chunkSize);
+        ASSERT_GT(result.makespan, isolatedResult.collectiveTime());
+        ASSERT_DOUBLE_EQ(result.makespan,
+                         std::max(result.completionTimes[0], result.completionTimes[1]));
+    }
+}
+
+TEST_F(TestConfig, ConcurrentAllReduceMesh2D) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto chunkSize = int64_t(1 << 20);
+
+    // all-reduces along every row
+    auto collective = ConcurrentCollective();
+    for (auto row = 0; row < 3; row++) {
+        collective.add(AllReduce(3), {row * 3, row * 3 + 1, row * 3 + 2});
+    }
+    ASSERT_TRUE(collective.reduction());
+    ASSERT_TRUE(collective.gathered());
+
+    auto concurrentSynthesizer = ConcurrentSynthesizer();
+    concurrentSynthesizer.synthesizer().reductionCost(10, 5);
+    auto result = concurrentSynthesizer.solve(topology, collective, chunkSize);
+
+    // the groups complete along with the joint schedule, including the reduction costs
+    auto synthesizer = Synthesizer();
+    synthesizer.reductionCost(10, 5);
+    const auto jointResult = synthesizer.solve(topology, collective, chunkSize);
+    ASSERT_DOUBLE_EQ(result.makespan, jointResult.collectiveTime());
+    for (auto group = 0; group < collective.groupsCount(); group++) {
+        // every chunk is reduced from the 2 other NPUs of the row, and gathered back to them
+        auto reductionsCount = 0;
+        auto gathersCount = 0;
+        for (auto npu = 0; npu < topology.npusCount(); npu++) {
+            for (const auto& [src, link] : result.synthesisResults[group].npu(npu).ingressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    reductionsCount += op.reduction();
+                    gathersCount += !op.reduction();
+                }
+            }
+        }
+        ASSERT_GE(reductionsCount, 3 * 2);
+        ASSERT_GE(gathersCount, 3 * 2);
+        ASSERT_LE(result.completionTimes[group], result.makespan);
+    }
+}
+
+TEST_F(TestConfig, ConcurrentReduceScatterMesh2D) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto chunkSize = int64_t(1 << 20);
+
+    // reduce-scatters along every row
+    auto collective = ConcurrentCollective();
+    for (auto row = 0; row < 3; row++) {
+        collective.add(ReduceScatter(3), {row * 3, row * 3 + 1, row * 3 + 2});
+    }
+
+    for (int i = 0; i < repeat; ++i) {
+        // every group completes once its chunks are reduced at their owners,
+        // reduction costs included, and the last one with the joint schedule
+        auto concurrentSynthesizer = ConcurrentSynthesizer();
+        concurrentSynthesizer.synthesizer().seed(i);
+        concurrentSynthesizer.synthesizer().reductionCost(10, 5);
+        const auto result = concurrentSynthesizer.solve(topology, collective, chunkSize);
+
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        synthesizer.reductionCost(10, 5);
+        const auto jointResult = synthesizer.solve(topology, collective, chunkSize);
+        ASSERT_DOUBLE_EQ(result.makespan, jointResult.collectiveTime());
+        for (auto group = 0; group < collective.groupsCount(); group++) {
+            const auto reductionTime = synthesizer.reductionTime(chunkSize);
+            ASSERT_GE(result.completionTimes[group], reductionTime * 2);
+        }
+    }
+}
@@ -0,0 +1,233 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <pugixml.hpp>
+#include <sstream>
+#include <string>
+#include <tacos/collective/custom_collective.h>
+#include <tacos/synthesizer/chunk_tuner.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/mesh_2d.h>
+#include <tacos/writer/xml_writer.h>
+#include <test_config.h>
+#include <unordered_set>
+#include <vector>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief Append a little-endian unsigned integer to a binary buffer
+void append(std::string& buffer, const uint64_t value, const int length) {
+    for (auto i = 0; i < length; i++) {
+        buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+}  // namespace
+
+TEST_F(TestConfig, CustomCollectiveText) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+
+    // pipeline-parallel shift: every NPU sends 2 chunks to the next one,
+    // along with a sparse gather of 4 MB chunks into NPU 0 and a broadcast from NPU 4
+    auto text = std::string("# shift and sparse gather\nname shift\n\n");
+    for (auto npu = 0; npu < npusCount; npu++) {
+        const auto next = std::to_string((npu + 1) % npusCount);
+        text += std::to_string(npu) + " " + next + "\n";
+        text += std::to_string(npu) + "\t" + next + "\r\n";
+    }
+    text += "2 0 4194304\n6 0,1-1 4194304\n4 *\n";
+    auto input = std::istringstream(text);
+    const auto collective = CustomCollective::read(input, topology);
+    ASSERT_NE(collective, nullptr);
+
+    ASSERT_EQ(collective->name(), "shift");
+    ASSERT_EQ(collective->chunksCount(), npusCount * 2 + 3);
+    ASSERT_TRUE(collective->sized());
+    for (auto npu = 0; npu < npusCount; npu++) {
+        const auto next = std::unordered_set<Collective::NpuID>{(npu + 1) % npusCount};
+        for (auto chunk = npu * 2; chunk < npu * 2 + 2; chunk++) {
+            ASSERT_EQ(collective->precondition(chunk), npu);
+            ASSERT_EQ(collective->postcondition(chunk), next);
+            ASSERT_EQ(collective->size(chunk), 0);
+        }
+    }
+    const auto gather = npusCount * 2;
+    ASSERT_EQ(collective->postcondition(gather), std::unordered_set<Collective::NpuID>{0});
+    ASSERT_EQ(collective->postcondition(gather + 1),
+              (std::unordered_set<Collective::NpuID>{0, 1}));
+    ASSERT_EQ(collective->size(gather + 1), 4194304);
+    ASSERT_EQ(collective->postcondition(gather + 2).size(), npusCount);
+
+    // the custom pattern is synthesized like any other
+    for (int i = 0; i < repeat; ++i) {
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        auto synthesisResult = synthesizer.solve(topology, *collective, 1 << 20);
+
+        auto arrived = std::vector<int>(collective->chunksCount(), 0);
+        for (auto npu = 0; npu < npusCount; npu++) {
+            for (const auto& [src, link] : synthesisResult.npu(npu).ingressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    arrived[op.chunkId()] += collective->postcondition(op.chunkId()).count(npu);
+                }
+            }
+        }
+        for (auto chunk = 0; chunk < collective->chunksCount(); chunk++) {
+            const auto& dests = collective->postcondition(chunk);
+            const auto expected =
+                static_cast<int>(dests.size()) - dests.count(collective->precondition(chunk));
+            ASSERT_EQ(arrived[chunk], expected);
+        }
+    }
+}
+
+TEST_F(TestConfig, CustomCollectiveBinary) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+
+    // every NPU sends a chunk to NPUs 0 and 8 (bitmap 0x01 0x01), sized 1 KB per source ID
+    auto binary = std::string("TACOSCOL");
+    append(binary, 1, 4);
+    append(binary, npusCount, 4);
+    append(binary, npusCount, 8);
+    append(binary, 1, 4);
+    for (auto npu = 0; npu < npusCount; npu++) {
+        append(binary, npu, 4);
+        append(binary, (npu + 1) * 1024, 8);
+        append(binary, 0x0101, 2);
+    }
+
+    const auto path = (std::filesystem::temp_directory_path() / "tacos_custom.bin").string();
+    std::ofstream(path, std::ios::binary) << binary;
+    const auto collective = CustomCollective::load(path, topology);
+    ASSERT_NE(collective, nullptr);
+    ASSERT_EQ(collective->chunksCount(), npusCount);
+    for (auto chunk = 0; chunk < npusCount; chunk++) {
+        ASSERT_EQ(collective->precondition(chunk), chunk);
+        ASSERT_EQ(collective->postcondition(chunk),
+                  (std::unordered_set<Collective::NpuID>{0, 8}));
+        ASSERT_EQ(collective->size(chunk), (chunk + 1) * 1024);
+    }
+
+    // truncated or trailing records, and a different number of NPUs are rejected
+    std::ofstream(path, std::ios::binary) << binary.substr(0, binary.size() - 1);
+    ASSERT_EQ(CustomCollective::load(path, topology), nullptr);
+    std::ofstream(path, std::ios::binary) << binary << '\0';
+    ASSERT_EQ(CustomCollective::load(path, topology), nullptr);
+    ASSERT_EQ(CustomCollective::load(path, Mesh2D(4, 4, 50.0, 0.5)), nullptr);
+
+    // a header announcing more chunks than the records present is rejected up front
+    auto oversized = binary.substr(0, 28);
+    oversized.replace(16, 8, std::string("\xff\xff\xff\x7f\0\0\0\0", 8));
+    auto oversizedInput = std::istringstream(oversized);
+    ASSERT_EQ(CustomCollective::read(oversizedInput, topology), nullptr);
+    auto truncatedInput = std::istringstream(binary.substr(0, 28));
+    ASSERT_EQ(CustomCollective::read(truncatedInput, topology), nullptr);
+
+    std::filesystem::remove(path);
+    ASSERT_EQ(CustomCollective::load(path, topology), nullptr);
+}
+
+TEST_F(TestConfig, CustomCollectiveInvalid) {
+    const auto topology = Mesh2D(2, 2, 50.0, 0.5);
+    for (const auto* const text : {"", "# nothing\n", "4 0\n", "0 4\n", "0 1-4\n", "0 2-1\n",
+                                   "0\n", "0 1 x\n", "0 1 2 3\n", "-1 0\n", "0 1,\n", "name\n"}) {
+        auto input = std::istringstream(text);
+        ASSERT_EQ(CustomCollective::read(input, topology), nullptr) << text;
+    }
+}
+
+TEST_F(TestConfig, CustomCollectiveReplicas) {
+    const auto topology = Mesh2D(4, 4, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto chunkSize = int64_t(1 << 20);
+
+    // all-gather of chunks already spread to the opposite NPU (e.g., by a previous collective)
+    auto plainText = std::string();
+    auto replicatedText = std::string();
+    for (auto npu = 0; npu < npusCount; npu++) {
+        plainText += std::to_string(npu) + " *\n";
+        const auto opposite = std::to_string(npusCount - 1 - npu);
+        replicatedText += std::to_string(npu) + "," + opposite + " *\n";
+    }
+    auto plainInput = std::istringstream(plainText);
+    const auto plain = CustomCollective::read(plainInput, topology);
+    auto replicatedInput = std::istringstream(replicatedText);
+    const auto replicated = CustomCollective::read(replicatedInput, topology);
+    ASSERT_NE(replicated, nullptr);
+    ASSERT_FALSE(plain->replicated());
+    ASSERT_TRUE(replicated->replicated());
+    for (auto chunk = 0; chunk < npusCount; chunk++) {
+        ASSERT_EQ(replicated->precondition(chunk), chunk);
+        const auto opposite = npusCount - 1 - chunk;
+        ASSERT_EQ(replicated->replicas(chunk), std::vector<Collective::NpuID>{opposite});
+    }
+    ASSERT_LT(ChunkTuner::lowerBound(topology, *replicated, chunkSize),
+              ChunkTuner::lowerBound(topology, *plain, chunkSize));
+
+    auto plainTime = 0.0;
+    auto replicatedTime = 0.0;
+    for (int i = 0; i < repeat; ++i) {
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        auto synthesisResult = synthesizer.solve(topology, *replicated, chunkSize);
+        auto plainSynthesizer = Synthesizer();
+        plainSynthesizer.seed(i);
+        plainTime += plainSynthesizer.solve(topology, *plain, chunkSize).collectiveTime();
+        replicatedTime += synthesisResult.collectiveTime();
+
+        // only the NPUs without a replica receive the chunk, once,
+        // and a chunk is sent without dependency only by its holders
+        for (auto npu = 0; npu < npusCount; npu++) {
+            auto recvsCount = std::vector<int>(npusCount, 0);
+            for (const auto& [src, link] : synthesisResult.npu(npu).ingressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    recvsCount[op.chunkId()]++;
+                }
+            }
+            for (const auto& [dest, link] : synthesisResult.npu(npu).egressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    const auto chunk = op.chunkId();
+                    const auto holder = (npu == chunk || npu == npusCount - 1 - chunk);
+                    ASSERT_EQ(op.hasDep(), !holder);
+                }
+            }
+            for (auto chunk = 0; chunk < npusCount; chunk++) {
+                const auto holder = (npu == chunk || npu == npusCount - 1 - chunk);
+                ASSERT_EQ(recvsCount[chunk], holder ? 0 : 1);
+            }
+        }
+    }
+    ASSERT_LT(replicatedTime, plainTime);
+
+    // the replicas are in place in the output buffers of their holders
+    auto synthesizer = Synthesizer();
+    auto synthesisResult = synthesizer.solve(topology, *replicated, chunkSize);
+    const auto path = (std::filesystem::temp_directory_path() / "tacos_replicas.xml").string();
+    auto writer = XmlWriter(path, topology, *replicated, synthesisResult);
+    writer.write();
+    auto doc = pugi::xml_document();
+    ASSERT_TRUE(doc.load_file(path.c_str()));
+    auto recvsCount = 0;
+    for (const auto gpu : doc.child("algo").children("gpu")) {
+        for (const auto tb : gpu.children("tb")) {
+            for (const auto step : tb.children("step")) {
+                recvsCount += (std::string(step.attribute("type").value()) == "r");
+            }
+        }
+    }
+    ASSERT_EQ(recvsCount, npusCount * (npusCount - 2));
+    std::filesystem::remove(path);
+}
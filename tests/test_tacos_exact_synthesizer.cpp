@@ -0,0 +1,64 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <tacos/collective/all_gather.h>
+#include <tacos/synthesizer/chunk_tuner.h>
+#include <tacos/synthesizer/exact_synthesizer.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/mesh_2d_hetero.h>
+#include <test_config.h>
+
+using namespace tacos;
+
+TEST_F(TestConfig, ExactSynthesizerMesh2DHetero) {
+    const auto topology = Mesh2D_Hetero(2, 2, 100.0, 0.5, 25.0, 1.0);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 2);
+    const auto chunkSize = int64_t(1 << 20);
+
+    // the search over a 2x2 mesh is exhausted well within the budget
+    auto exactSynthesizer = ExactSynthesizer(10000);
+    auto result = exactSynthesizer.solve(topology, collective, chunkSize);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE(result->optimal);
+    auto& synthesisResult = result->synthesisResult;
+    const auto collectiveTime = synthesisResult.collectiveTime();
+    ASSERT_DOUBLE_EQ(result->lowerBound, collectiveTime);
+    ASSERT_GE(collectiveTime, ChunkTuner::lowerBound(topology, collective, chunkSize));
+
+    // no heuristic schedule beats the optimal one
+    auto synthesizer = Synthesizer();
+    for (int i = 0; i < repeat; ++i) {
+        const auto heuristicResult = synthesizer.solve(topology, collective, chunkSize);
+        ASSERT_LE(collectiveTime, heuristicResult.collectiveTime() + 1e-9);
+    }
+
+    // the schedule is a valid all-gather schedule
+    ASSERT_NO_FATAL_FAILURE(
+        checkAllGatherSchedule(synthesisResult, npusCount, collective.chunksCount()));
+}
+
+TEST_F(TestConfig, ExactSynthesizerThreads) {
+    const auto topology = Mesh2D_Hetero(2, 2, 100.0, 0.5, 25.0, 1.0);
+    const auto collective = AllGather(topology.npusCount(), 2);
+    const auto chunkSize = int64_t(1 << 20);
+
+    auto exactSynthesizer = ExactSynthesizer(10000);
+    const auto result = exactSynthesizer.solve(topology, collective, chunkSize);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE(result->optimal);
+
+    // the workers split the tree, yet prove the same optimal collective time
+    auto parallelSynthesizer = ExactSynthesizer(10000, 4);
+    const auto parallelResult = parallelSynthesizer.solve(topology, collective, chunkSize);
+    ASSERT_TRUE(parallelResult.has_value());
+    ASSERT_TRUE(parallelResult->optimal);
+    ASSERT_DOUBLE_EQ(parallelResult->lowerBound, result->lowerBound);
+}
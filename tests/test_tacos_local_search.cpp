@@ -0,0 +1,45 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <tacos/collective/all_gather.h>
+#include <tacos/synthesizer/local_search.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/mesh_2d_hetero.h>
+#include <test_config.h>
+
+using namespace tacos;
+
+TEST_F(TestConfig, LocalSearchMesh2DHetero) {
+    const auto topology = Mesh2D_Hetero(4, 4, 100.0, 0.5, 25.0, 1.0);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 2);
+    const auto chunkSize = int64_t(1 << 20);
+
+    auto synthesizer = Synthesizer();
+    auto localSearch = LocalSearch(20);
+    auto improvedCount = 0;
+    for (int i = 0; i < repeat; ++i) {
+        auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+        const auto collectiveTime = synthesisResult.collectiveTime();
+        if (!localSearch.improve(topology, collective, chunkSize, synthesisResult)) {
+            ASSERT_EQ(synthesisResult.collectiveTime(), collectiveTime);
+            continue;
+        }
+        improvedCount++;
+        ASSERT_LT(synthesisResult.collectiveTime(), collectiveTime);
+
+        // the improved schedule is still a valid all-gather schedule
+        ASSERT_NO_FATAL_FAILURE(
+            checkAllGatherSchedule(synthesisResult, npusCount, collective.chunksCount()));
+    }
+
+    // random schedules of heterogeneous meshes leave room for improvement
+    ASSERT_GT(improvedCount, 0);
+}
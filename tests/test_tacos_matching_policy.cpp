@@ -0,0 +1,173 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <climits>
+#include <cstdlib>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <tacos/collective/all_gather.h>
+#include <tacos/collective/collective.h>
+#include <tacos/event_queue/event_queue.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/hetero_mesh_3d.h>
+#include <tacos/topology/mesh_2d.h>
+#include <tacos/topology/mesh_2d_hetero.h>
+#include <tacos/topology/torus_2d.h>
+#include <test_config.h>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief Chunks sent from a single source NPU to a single destination NPU
+class PointToPoint final : public Collective {
+  public:
+    PointToPoint(const NpuID src, const NpuID dest, const int chunksCount) noexcept {
+        for (auto chunk = 0; chunk < chunksCount; chunk++) {
+            chunk_(src, {dest});
+        }
+    }
+};
+
+}  // namespace
+
+TEST_F(TestConfig, LookaheadMesh5x5) {
+    const auto topology = Mesh2D(5, 5, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 1);
+    const auto chunkSize = int64_t(1024) * (1 << 20) / npusCount;
+
+    auto synthesizer = Synthesizer();
+    synthesizer.matchingPolicy(Synthesizer::MatchingPolicy::Lookahead);
+
+    auto minCollectiveTime = std::numeric_limits<EventQueue::Time>::max();
+    for (int i = 0; i < repeat; ++i) {
+        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize).collectiveTime();
+        minCollectiveTime = std::min(minCollectiveTime, collectiveTime);
+    }
+
+    const auto expected = 9606.0;
+    const auto margin = expected * tolerance;
+    ASSERT_NEAR(minCollectiveTime, expected, margin);
+}
+
+TEST_F(TestConfig, LookaheadTorus4x4) {
+    const auto topology = Torus2D(4, 4, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 1);
+    const auto chunkSize = int64_t(1 << 20);
+
+    // the wrap-around links yield many earliest-arrival ties,
+    // which lookahead breaks better than random on average
+    auto averageCollectiveTime = [&](const Synthesizer::MatchingPolicy policy) {
+        auto synthesizer = Synthesizer();
+        synthesizer.matchingPolicy(policy);
+        auto totalCollectiveTime = 0.0;
+        for (int i = 0; i < repeat; ++i) {
+            totalCollectiveTime +=
+                synthesizer.solve(topology, collective, chunkSize).collectiveTime();
+        }
+        return totalCollectiveTime / repeat;
+    };
+
+    const auto randomTime = averageCollectiveTime(Synthesizer::MatchingPolicy::Random);
+    const auto lookaheadTime = averageCollectiveTime(Synthesizer::MatchingPolicy::Lookahead);
+    ASSERT_LE(lookaheadTime, randomTime * (1 + tolerance));
+}
+
+TEST_F(TestConfig, TopologyDistances) {
+    const auto width = 4;
+    const auto height = 3;
+    const auto latency = 0.5;
+    const auto topology = Mesh2D(width, height, 50.0, latency);
+    const auto hops = topology.hopDistances();
+    const auto latencies = topology.pathLatencies();
+
+    // on a mesh, the distance is the Manhattan distance
+    for (auto src = 0; src < topology.npusCount(); src++) {
+        for (auto dest = 0; dest < topology.npusCount(); dest++) {
+            const auto manhattan =
+                std::abs((src % width) - (dest % width)) + std::abs((src / width) - (dest / width));
+            ASSERT_EQ(hops[src][dest], manhattan);
+            ASSERT_DOUBLE_EQ(latencies[src][dest], manhattan * latency);
+        }
+    }
+}
+
+TEST_F(TestConfig, DistancePriorityMesh2DHetero) {
+    const auto topology = Mesh2D_Hetero(4, 4, 100.0, 0.5, 25.0, 1.0);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 1);
+    const auto chunkSize = int64_t(1 << 20);
+
+    // long-haul chunks claim the links first, shortening the tail of the collective
+    auto averageCollectiveTime = [&](const Synthesizer::OrderingPolicy policy) {
+        auto synthesizer = Synthesizer();
+        synthesizer.orderingPolicy(policy);
+        auto totalCollectiveTime = 0.0;
+        for (int i = 0; i < repeat; ++i) {
+            totalCollectiveTime +=
+                synthesizer.solve(topology, collective, chunkSize).collectiveTime();
+        }
+        return totalCollectiveTime / repeat;
+    };
+
+    const auto randomTime = averageCollectiveTime(Synthesizer::OrderingPolicy::Random);
+    const auto distanceTime =
+        averageCollectiveTime(Synthesizer::OrderingPolicy::DistancePriority);
+    ASSERT_LE(distanceTime, randomTime * (1 + tolerance));
+}
+
+TEST_F(TestConfig, RarestFirstHeteroMesh3D) {
+    const auto topology = HeteroMesh3D(3, 3, 3, 200.0, 0.5, 100.0, 1.0, 25.0, 2.0);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 2);
+    const auto chunkSize = int64_t(1 << 20);
+
+    // replacements are frequent on heterogeneous meshes:
+    // spreading the scarcest chunks first raises the link utilization
+    auto averageCollectiveTime = [&](const Synthesizer::ReplacementPolicy policy) {
+        auto synthesizer = Synthesizer();
+        synthesizer.replacementPolicy(policy);
+        auto totalCollectiveTime = 0.0;
+        for (int i = 0; i < repeat; ++i) {
+            totalCollectiveTime +=
+                synthesizer.solve(topology, collective, chunkSize).collectiveTime();
+        }
+        return totalCollectiveTime / repeat;
+    };
+
+    const auto randomTime = averageCollectiveTime(Synthesizer::ReplacementPolicy::Random);
+    const auto rarestTime = averageCollectiveTime(Synthesizer::ReplacementPolicy::RarestFirst);
+    ASSERT_LE(rarestTime, randomTime * (1 + tolerance));
+}
+
+TEST_F(TestConfig, SpeculativeRelayMesh4x4) {
+    const auto topology = Mesh2D(4, 4, 50.0, 0.5);
+    const auto collective = PointToPoint(0, 15, 1);
+    const auto chunkSize = int64_t(1 << 20);
+
+    // the intermediate NPUs are no destinations, so only relays can carry the chunk
+    auto synthesizer = Synthesizer();
+    synthesizer.speculativeRelay(4);
+
+    const auto linkTime = 0.5 + chunkSize / (50.0 * (1 << 30) / 1e6);
+    for (int i = 0; i < repeat; ++i) {
+        auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+        ASSERT_NEAR(synthesisResult.collectiveTime(), 6 * linkTime, 1e-6);
+
+        // every relay made progress along a shortest path: no wasted transfer is recorded
+        auto sendsCount = 0;
+        for (auto npu = 0; npu < topology.npusCount(); npu++) {
+            for (const auto& [dest, link] : synthesisResult.npu(npu).egressLinks()) {
+                sendsCount += static_cast<int>(link.ops().size());
+            }
+        }
+        ASSERT_EQ(sendsCount, 6);
+    }
+}
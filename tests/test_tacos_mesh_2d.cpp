@@ -38,7 +38,7 @@ TEST_F(TestConfig, Mesh5x5) {
 
     auto minCollectiveTime = std::numeric_limits<EventQueue::Time>::max();
     for (int i = 0; i < repeat; ++i) {
-        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize);
+        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize).collectiveTime();
         minCollectiveTime = std::min(minCollectiveTime, collectiveTime);
     }
 
@@ -68,7 +68,7 @@ TEST_F(TestConfig, Mesh10x10) {
 
     auto minCollectiveTime = std::numeric_limits<EventQueue::Time>::max();
     for (int i = 0; i < repeat; ++i) {
-        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize);
+        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize).collectiveTime();
         minCollectiveTime = std::min(minCollectiveTime, collectiveTime);
     }
 
@@ -98,7 +98,7 @@ TEST_F(TestConfig, Mesh7x12) {
 
     auto minCollectiveTime = std::numeric_limits<EventQueue::Time>::max();
     for (int i = 0; i < repeat; ++i) {
-        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize);
+        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize).collectiveTime();
         minCollectiveTime = std::min(minCollectiveTime, collectiveTime);
     }
 
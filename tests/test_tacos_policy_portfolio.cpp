@@ -0,0 +1,95 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <tacos/collective/all_gather.h>
+#include <tacos/synthesizer/chunk_tuner.h>
+#include <tacos/synthesizer/policy_portfolio.h>
+#include <tacos/synthesizer/synthesis_policy.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/hetero_mesh_2d.h>
+#include <tacos/topology/torus_2d.h>
+#include <test_config.h>
+#include <tuple>
+#include <vector>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief Deterministic policy: always the lowest NPU ID and chunk ID, counting its decisions
+class LowestIdPolicy final : public SynthesisPolicy {
+  public:
+    int sourcesSelected = 0;
+
+    NpuID selectSource(const State& state,
+                       const ChunkID chunk,
+                       const NpuID /*dest*/,
+                       const std::vector<NpuID>& candidates) noexcept override {
+        EXPECT_TRUE(state.chunkMap[chunk][candidates.front()]);
+        sourcesSelected++;
+        return *std::min_element(candidates.begin(), candidates.end());
+    }
+
+    ChunkID selectReplacement(const State& /*state*/,
+                              const NpuID /*src*/,
+                              const NpuID /*dest*/,
+                              const std::vector<ChunkID>& candidates) noexcept override {
+        return *std::min_element(candidates.begin(), candidates.end());
+    }
+};
+
+}  // namespace
+
+TEST_F(TestConfig, CustomSynthesisPolicy) {
+    const auto topology = Torus2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 1);
+    const auto chunkSize = int64_t(1 << 20);
+
+    auto policy = std::make_shared<LowestIdPolicy>();
+    auto synthesizer = Synthesizer();
+    synthesizer.policy(policy);
+
+    // every (chunk, dest) postcondition is matched at least once through the custom policy
+    const auto collectiveTime = synthesizer.solve(topology, collective, chunkSize).collectiveTime();
+    ASSERT_GE(policy->sourcesSelected, npusCount * (npusCount - 1));
+    ASSERT_GE(collectiveTime, ChunkTuner::lowerBound(topology, collective, chunkSize));
+
+    // restoring the built-in policies bypasses the custom one
+    const auto sourcesSelected = policy->sourcesSelected;
+    synthesizer.policy(nullptr);
+    std::ignore = synthesizer.solve(topology, collective, chunkSize);
+    ASSERT_EQ(policy->sourcesSelected, sourcesSelected);
+}
+
+TEST_F(TestConfig, PolicyPortfolioRace) {
+    const auto topology = HeteroMesh2D(4, 4, 100.0, 0.5, 25.0, 1.0);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 2);
+    const auto chunkSize = int64_t(1 << 20);
+
+    auto portfolio = PolicyPortfolio::builtIn();
+    const auto custom = portfolio.add([](Synthesizer& synthesizer) {
+        synthesizer.policy(std::make_shared<LowestIdPolicy>());
+    });
+    ASSERT_EQ(custom, 3);
+
+    // the winner is one of the configurations, and cannot beat the lower bound
+    const auto bound = ChunkTuner::lowerBound(topology, collective, chunkSize);
+    for (int i = 0; i < repeat; ++i) {
+        const auto result = portfolio.race(topology, collective, chunkSize, 60 * 1000);
+        ASSERT_TRUE(result.has_value());
+        ASSERT_GE(result->winner, 0);
+        ASSERT_LE(result->winner, custom);
+        ASSERT_GE(result->synthesisResult.collectiveTime(), bound);
+    }
+}
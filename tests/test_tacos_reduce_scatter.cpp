@@ -0,0 +1,107 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cstdint>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <pugixml.hpp>
+#include <string>
+#include <tacos/collective/reduce_scatter.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/hetero_mesh_2d.h>
+#include <tacos/topology/mesh_2d.h>
+#include <tacos/writer/xml_writer.h>
+#include <test_config.h>
+#include <vector>
+
+using namespace tacos;
+
+TEST_F(TestConfig, ReduceScatterMesh2D) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto collective = ReduceScatter(npusCount, 2);
+    const auto chunksCount = collective.chunksCount();
+    const auto chunkSize = int64_t(1 << 20);
+    ASSERT_TRUE(collective.reduction());
+
+    for (int i = 0; i < repeat; ++i) {
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+
+        // every NPU but the owner sends every chunk exactly once, after it received
+        // (and reduced) the partial chunks it depends on
+        auto sendsCount = std::vector<int>(chunksCount * npusCount, 0);
+        for (auto npu = 0; npu < npusCount; npu++) {
+            for (const auto& [dest, link] : synthesisResult.npu(npu).egressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    sendsCount[op.chunkId() * npusCount + npu]++;
+                    if (op.hasDep()) {
+                        ASSERT_LT(op.depOp()->time(), op.time());
+                    }
+                }
+            }
+        }
+        for (auto chunk = 0; chunk < chunksCount; chunk++) {
+            const auto owner = collective.precondition(chunk);
+            for (auto npu = 0; npu < npusCount; npu++) {
+                ASSERT_EQ(sendsCount[chunk * npusCount + npu], npu == owner ? 0 : 1);
+            }
+        }
+
+        // reducing partial chunks delays the same (reversed) schedule by at least one reduction
+        auto costlySynthesizer = Synthesizer();
+        costlySynthesizer.seed(i);
+        costlySynthesizer.reductionCost(100.0, 1.0);
+        const auto costlyResult = costlySynthesizer.solve(topology, collective, chunkSize);
+        ASSERT_GE(costlyResult.collectiveTime(), synthesisResult.collectiveTime() + 1.0);
+    }
+}
+
+TEST_F(TestConfig, ReduceScatterXmlWriter) {
+    const auto topology = HeteroMesh2D(3, 3, 50.0, 0.5, 25.0, 1.0);
+    const auto npusCount = topology.npusCount();
+    const auto collective = ReduceScatter(npusCount, 2);
+    const auto chunkSize = int64_t(1 << 20);
+
+    auto synthesizer = Synthesizer();
+    auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+
+    const auto path = (std::filesystem::temp_directory_path() / "tacos_rs.xml").string();
+    auto writer = XmlWriter(path, topology, collective, synthesisResult);
+    writer.fuseThreadblocks();
+    writer.write();
+
+    auto doc = pugi::xml_document();
+    ASSERT_TRUE(doc.load_file(path.c_str()));
+    const auto algo = doc.child("algo");
+    ASSERT_STREQ(algo.attribute("coll").value(), "reducescatter");
+    const auto chunksPerLoop = algo.attribute("nchunksperloop").as_int();
+
+    // every partial chunk received is reduced (possibly sent on in the same step),
+    // and every NPU receives the partial chunks of all others
+    auto recvsCount = 0;
+    auto fusedCount = 0;
+    for (const auto gpu : algo.children("gpu")) {
+        ASSERT_EQ(gpu.attribute("i_chunks").as_int(), chunksPerLoop);
+        ASSERT_EQ(gpu.attribute("o_chunks").as_int(), chunksPerLoop / npusCount);
+        for (const auto tb : gpu.children("tb")) {
+            for (const auto step : tb.children("step")) {
+                const auto type = std::string(step.attribute("type").value());
+                ASSERT_TRUE(type == "s" || type == "rrc" || type == "rrs");
+                ASSERT_STREQ(step.attribute("srcbuf").value(), "i");
+                recvsCount += (type != "s");
+                fusedCount += (type == "rrs");
+            }
+        }
+    }
+    ASSERT_EQ(recvsCount, collective.chunksCount() * (npusCount - 1));
+    ASSERT_GT(fusedCount, 0);
+
+    std::filesystem::remove(path);
+}
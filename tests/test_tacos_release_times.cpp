@@ -0,0 +1,135 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <tacos/collective/all_gather.h>
+#include <tacos/collective/reduce_scatter.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/synthesizer/time_expanded_network.h>
+#include <tacos/topology/mesh_2d.h>
+#include <test_config.h>
+#include <vector>
+
+using namespace tacos;
+
+TEST_F(TestConfig, ReleaseTimesAllGather) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto chunkSize = int64_t(1 << 20);
+    const auto linkTime = TimeExpandedNetwork(topology, chunkSize).linkTransferTime(0, 1);
+
+    // the second chunk of every NPU is computed later, the last NPUs being the slowest
+    auto collective = AllGather(npusCount, 2);
+    for (auto chunk = 0; chunk < collective.chunksCount(); chunk++) {
+        if (chunk % 2 == 1) {
+            collective.releaseTime(chunk, linkTime * (chunk / 2 + 1));
+        }
+    }
+    ASSERT_TRUE(collective.staggered());
+    ASSERT_FALSE(collective.prioritized());
+    ASSERT_DOUBLE_EQ(collective.releaseTime(0), 0);
+    const auto lastReleaseTime = linkTime * npusCount;
+
+    for (int i = 0; i < repeat; ++i) {
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+
+        // no chunk leaves before its release, and every NPU still receives every chunk once
+        auto arrivals = std::vector<int>(collective.chunksCount() * npusCount, 0);
+        for (auto npu = 0; npu < npusCount; npu++) {
+            for (const auto& [src, link] : synthesisResult.npu(npu).ingressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    const auto startTime = op.time() - linkTime;
+                    ASSERT_GE(startTime + 1e-9, collective.releaseTime(op.chunkId()));
+                    arrivals[op.chunkId() * npusCount + npu]++;
+                }
+            }
+        }
+        for (auto chunk = 0; chunk < collective.chunksCount(); chunk++) {
+            for (auto npu = 0; npu < npusCount; npu++) {
+                const auto held = (npu == collective.precondition(chunk));
+                ASSERT_EQ(arrivals[chunk * npusCount + npu], held ? 0 : 1);
+            }
+        }
+        ASSERT_GE(synthesisResult.collectiveTime(), lastReleaseTime + linkTime);
+    }
+}
+
+TEST_F(TestConfig, DeadlinesAllGather) {
+    const auto topology = Mesh2D(4, 4, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto chunkSize = int64_t(1 << 20);
+
+    // the first chunk of every NPU is needed first (e.g., by the next layer)
+    const auto plain = AllGather(npusCount, 2);
+    auto collective = AllGather(npusCount, 2);
+    for (auto chunk = 0; chunk < collective.chunksCount(); chunk += 2) {
+        collective.deadline(chunk, 0);
+    }
+    ASSERT_TRUE(collective.prioritized());
+    ASSERT_FALSE(collective.staggered());
+    ASSERT_EQ(collective.deadline(1), plain.deadline(1));
+
+    const auto urgentTime = [&](SynthesisResult synthesisResult) {
+        auto time = 0.0;
+        for (auto npu = 0; npu < npusCount; npu++) {
+            for (const auto& [src, link] : synthesisResult.npu(npu).ingressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    if (op.chunkId() % 2 == 0) {
+                        time = std::max(time, op.time());
+                    }
+                }
+            }
+        }
+        return time;
+    };
+
+    // the urgent chunks claim the links first, and thus complete earlier
+    auto prioritizedTime = 0.0;
+    auto plainTime = 0.0;
+    for (int i = 0; i < repeat; ++i) {
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        prioritizedTime += urgentTime(synthesizer.solve(topology, collective, chunkSize));
+        auto plainSynthesizer = Synthesizer();
+        plainSynthesizer.seed(i);
+        plainTime += urgentTime(plainSynthesizer.solve(topology, plain, chunkSize));
+    }
+    ASSERT_LT(prioritizedTime, plainTime);
+}
+
+TEST_F(TestConfig, ReleaseTimesReduceScatter) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto chunkSize = int64_t(1 << 20);
+    const auto linkTime = TimeExpandedNetwork(topology, chunkSize).linkTransferTime(0, 1);
+
+    // the partial chunks reduced into NPU 4 are computed late on every NPU
+    auto collective = ReduceScatter(npusCount);
+    const auto releaseTime = linkTime * 3;
+    collective.releaseTime(4, releaseTime);
+
+    for (int i = 0; i < repeat; ++i) {
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+        for (auto npu = 0; npu < npusCount; npu++) {
+            for (const auto& [src, link] : synthesisResult.npu(npu).ingressLinks()) {
+                for (const auto& [opId, op] : link.ops()) {
+                    ASSERT_TRUE(op.reduction());
+                    const auto startTime = op.time() - linkTime;
+                    ASSERT_GE(startTime + 1e-9, collective.releaseTime(op.chunkId()));
+                }
+            }
+        }
+        ASSERT_GE(synthesisResult.collectiveTime(), releaseTime + linkTime);
+    }
+}
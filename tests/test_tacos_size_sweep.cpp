@@ -0,0 +1,97 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <gtest/gtest.h>
+#include <pugixml.hpp>
+#include <tacos/collective/all_gather.h>
+#include <tacos/synthesizer/size_sweep.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/hetero_mesh_2d.h>
+#include <tacos/topology/mesh_2d.h>
+#include <tacos/writer/xml_writer.h>
+#include <test_config.h>
+
+using namespace tacos;
+
+TEST_F(TestConfig, SizeSweepHomogeneous) {
+    // every link takes the same time at any size, so all sizes share one schedule
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto collective = AllGather(topology.npusCount(), 2);
+
+    const auto minBytes = int64_t(1 << 10);
+    const auto maxBytes = int64_t(1 << 20);
+    auto sweep = SizeSweep(minBytes, maxBytes);
+    const auto ranges = sweep.solve(topology, collective);
+
+    ASSERT_EQ(ranges.size(), 1);
+    ASSERT_EQ(ranges.front().minBytes, minBytes);
+    ASSERT_EQ(ranges.front().maxBytes, maxBytes * 2);
+}
+
+TEST_F(TestConfig, SizeSweepHeterogeneous) {
+    const auto topology = HeteroMesh2D(3, 3, 200.0, 10.0, 25.0, 0.5);
+    const auto collective = AllGather(topology.npusCount(), 2);
+
+    const auto minBytes = int64_t(1 << 10);
+    const auto maxBytes = int64_t(1 << 26);
+    auto sweep = SizeSweep(minBytes, maxBytes, 4);
+    auto ranges = sweep.solve(topology, collective);
+
+    // ranges tile the swept sizes, and consecutive ranges have different schedules
+    ASSERT_FALSE(ranges.empty());
+    ASSERT_EQ(ranges.front().minBytes, minBytes);
+    for (auto i = 1; i < static_cast<int>(ranges.size()); i++) {
+        ASSERT_EQ(ranges[i - 1].maxBytes, ranges[i].minBytes);
+        ASSERT_FALSE(ranges[i - 1].result.sameSchedule(ranges[i].result));
+    }
+
+    // every range is written as an algorithm with its byte range
+    const auto path = (std::filesystem::temp_directory_path() / "tacos_sweep.xml").string();
+    for (auto& range : ranges) {
+        auto writer = XmlWriter(path, topology, collective, range.result);
+        writer.bytes(range.minBytes, range.maxBytes);
+        writer.write();
+
+        auto xml = pugi::xml_document();
+        ASSERT_TRUE(xml.load_file(path.c_str()));
+        const auto algo = xml.document_element();
+        ASSERT_EQ(algo.attribute("minBytes").as_llong(), range.minBytes);
+        ASSERT_EQ(algo.attribute("maxBytes").as_llong(), range.maxBytes);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST_F(TestConfig, SynthesizerReuseFollowsTopology) {
+    // distinct topologies have distinct generations, and copies share them
+    const auto mesh = Mesh2D(3, 3, 50.0, 0.5);
+    const auto copy = mesh;
+    ASSERT_EQ(copy.generation(), mesh.generation());
+    ASSERT_NE(Mesh2D(3, 3, 50.0, 0.5).generation(), mesh.generation());
+
+    // a synthesizer reused on another topology at the same address must not keep its link times
+    const auto collective = AllGather(9, 2);
+    const auto chunkSize = int64_t(1 << 20);
+    auto topology = std::optional<Mesh2D>();
+    auto synthesizer = Synthesizer();
+
+    topology.emplace(3, 3, 50.0, 0.5);
+    synthesizer.seed(0);
+    const auto fastTime = synthesizer.solve(*topology, collective, chunkSize).collectiveTime();
+
+    topology.emplace(3, 3, 5.0, 0.5);
+    synthesizer.seed(0);
+    const auto slowTime = synthesizer.solve(*topology, collective, chunkSize).collectiveTime();
+
+    auto fresh = Synthesizer();
+    fresh.seed(0);
+    ASSERT_DOUBLE_EQ(slowTime, fresh.solve(*topology, collective, chunkSize).collectiveTime());
+    ASSERT_GT(slowTime, fastTime);
+}
@@ -0,0 +1,85 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <tacos/collective/all_gather.h>
+#include <tacos/synthesizer/cancellation_token.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/mesh_2d.h>
+#include <test_config.h>
+
+using namespace tacos;
+
+TEST_F(TestConfig, SolveAsyncMesh5x5) {
+    const auto width = 5;
+    const auto height = 5;
+    const auto latency = 0.5;
+    const auto bandwidth = 50.0;
+
+    const auto topology = Mesh2D(width, height, bandwidth, latency);
+    const auto npusCount = topology.npusCount();
+
+    const auto collectivesCount = 1;
+    const auto collective = AllGather(npusCount, collectivesCount);
+    const auto chunkSize = int64_t(1024) * (1 << 20) / (npusCount * collectivesCount);
+
+    auto synthesizer = Synthesizer();
+
+    auto reportsCount = 0;
+    auto lastProgress = Synthesizer::Progress{};
+    const auto callback = [&](const Synthesizer::Progress& progress) {
+        ASSERT_GE(progress.eventsProcessed, lastProgress.eventsProcessed);
+        ASSERT_GE(progress.satisfiedPostconditions, lastProgress.satisfiedPostconditions);
+        ASSERT_EQ(progress.satisfiedPostconditions + progress.remainingPostconditions,
+                  npusCount * npusCount);
+        lastProgress = progress;
+        reportsCount++;
+    };
+
+    auto future = synthesizer.solveAsync(topology, collective, chunkSize, CancellationToken(),
+                                         callback);
+    const auto synthesisResult = future.get();
+
+    ASSERT_TRUE(synthesisResult.has_value());
+    ASSERT_GT(reportsCount, 0);
+    ASSERT_EQ(lastProgress.remainingPostconditions, 0);
+    ASSERT_NEAR(lastProgress.currentTime, synthesisResult->collectiveTime(), 1e-9);
+}
+
+TEST_F(TestConfig, SolveAsyncCancelled) {
+    const auto width = 5;
+    const auto height = 5;
+    const auto latency = 0.5;
+    const auto bandwidth = 50.0;
+
+    const auto topology = Mesh2D(width, height, bandwidth, latency);
+    const auto npusCount = topology.npusCount();
+
+    const auto collectivesCount = 1;
+    const auto collective = AllGather(npusCount, collectivesCount);
+    const auto chunkSize = int64_t(1024) * (1 << 20) / (npusCount * collectivesCount);
+
+    auto synthesizer = Synthesizer();
+
+    // cancel the synthesis from the first progress report
+    auto cancellationToken = CancellationToken();
+    auto eventsProcessed = 0;
+    const auto callback = [&](const Synthesizer::Progress& progress) {
+        eventsProcessed = progress.eventsProcessed;
+        cancellationToken.cancel();
+    };
+
+    auto future = synthesizer.solveAsync(topology, collective, chunkSize, cancellationToken,
+                                         callback);
+    const auto synthesisResult = future.get();
+
+    ASSERT_TRUE(cancellationToken.cancelled());
+    ASSERT_FALSE(synthesisResult.has_value());
+    ASSERT_EQ(eventsProcessed, 1);
+}
@@ -0,0 +1,152 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <tacos/service/synthesis_service.h>
+#include <tacos/service/unix_socket_server.h>
+#include <tacos/topology/topology_parser.h>
+#include <test_config.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace tacos;
+
+TEST_F(TestConfig, TopologyParser) {
+    const auto mesh = TopologyParser::parse("mesh2d:4x3:50/0.5");
+    ASSERT_NE(mesh, nullptr);
+    ASSERT_EQ(mesh->npusCount(), 12);
+    ASSERT_TRUE(mesh->connected(0, 1));
+    ASSERT_FALSE(mesh->connected(0, 5));
+
+    const auto heteroMesh = TopologyParser::parse("hetero_mesh3d:2x2x2:50/0.5:25/1:10/2");
+    ASSERT_NE(heteroMesh, nullptr);
+    ASSERT_EQ(heteroMesh->npusCount(), 8);
+
+    ASSERT_EQ(TopologyParser::parse("mesh2d:4x3"), nullptr);
+    ASSERT_EQ(TopologyParser::parse("mesh2d:4x3x2:50/0.5"), nullptr);
+    ASSERT_EQ(TopologyParser::parse("hetero_mesh2d:4x3:50/0.5"), nullptr);
+    ASSERT_EQ(TopologyParser::parse("unknown:4x3:50/0.5"), nullptr);
+    ASSERT_EQ(TopologyParser::parse("mesh2d:4x3:50/0.5", 11), nullptr);
+    ASSERT_EQ(TopologyParser::parse("torus3d:65536x65536x65536:50/0.5", 1024), nullptr);
+}
+
+TEST_F(TestConfig, SynthesisServiceDeduplication) {
+    auto service = SynthesisService(2);
+
+    const auto request = SynthesisService::parseRequest("mesh2d:4x3:50/0.5 allgather:3 349525 0");
+    ASSERT_TRUE(request.has_value());
+
+    auto firstCached = true;
+    auto secondCached = false;
+    const auto first = service.submit(request.value(), &firstCached);
+    const auto second = service.submit(request.value(), &secondCached);
+    ASSERT_FALSE(firstCached);
+    ASSERT_TRUE(secondCached);
+
+    const auto& firstResponse = first.get();
+    const auto& secondResponse = second.get();
+    ASSERT_TRUE(firstResponse.ok);
+    ASSERT_EQ(firstResponse.trials, 1);
+    ASSERT_EQ(&firstResponse, &secondResponse);
+
+    ASSERT_EQ(service.handle("mesh2d:4x3:50/0.5 allgather:3"), "error malformed request");
+    ASSERT_EQ(service.handle("mesh2d:4x3:50/0.5 unknown 1024 0"),
+              "error invalid collective: unknown");
+}
+
+TEST_F(TestConfig, SynthesisServiceLimits) {
+    auto service = SynthesisService(1);
+
+    // nothing to synthesize
+    ASSERT_EQ(service.handle("mesh2d:1x1:50/0.5 allgather:1 100 0"),
+              "error invalid topology: mesh2d:1x1:50/0.5");
+
+    // requests beyond the limits of the service
+    ASSERT_EQ(service.handle("mesh2d:100000x100000:50/0.5 allgather:1 100 0"),
+              "error invalid topology: mesh2d:100000x100000:50/0.5");
+    ASSERT_EQ(service.handle("mesh2d:2x2:50/0.5 allgather:1000000 100 0"),
+              "error invalid collective: allgather:1000000");
+    ASSERT_EQ(service.handle("mesh2d:2x2:50/0.5 allgather:1 100 1e9"),
+              "error budget exceeds the limit");
+
+    ASSERT_EQ(service.handle("mesh2d:2x2:50/0.5 allgather:1 100 0").rfind("ok ", 0), 0);
+}
+
+TEST_F(TestConfig, SynthesisServiceEviction) {
+    // a single cached result: the least recently used one is evicted
+    auto service = SynthesisService(1, 1);
+    const auto first = SynthesisService::parseRequest("mesh2d:2x2:50/0.5 allgather:1 1024 0");
+    const auto second = SynthesisService::parseRequest("mesh2d:2x2:50/0.5 allgather:2 1024 0");
+    auto cached = false;
+    service.submit(first.value(), &cached).wait();
+    service.submit(first.value(), &cached).wait();
+    ASSERT_TRUE(cached);
+    service.submit(second.value(), &cached).wait();
+    ASSERT_FALSE(cached);
+    service.submit(first.value(), &cached).wait();
+    ASSERT_FALSE(cached);
+}
+
+TEST_F(TestConfig, UnixSocketServer) {
+    const auto path = (std::filesystem::temp_directory_path() / "tacos_test.sock").string();
+    const auto handler = [](const std::string& line) {
+        auto response = line;
+        for (auto& c : response) {
+            c = static_cast<char>(std::toupper(c));
+        }
+        return response;
+    };
+    auto server = UnixSocketServer(path, handler);
+    auto served = false;
+    auto serving = std::thread([&]() { served = server.serve(); });
+
+    // connect once the socket is bound
+    const auto client = socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_GE(client, 0);
+    auto address = sockaddr_un();
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    auto connected = false;
+    for (auto attempt = 0; attempt < 1000 && !connected; attempt++) {
+        connected = (connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0);
+        if (!connected) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    ASSERT_TRUE(connected);
+    const auto receive = [client]() {
+        auto response = std::string();
+        char c = 0;
+        while (read(client, &c, 1) == 1 && c != '\n') {
+            response.push_back(c);
+        }
+        return response;
+    };
+
+    // requests are answered line by line, and an endless line closes the connection
+    ASSERT_EQ(write(client, "tacos\n", 6), 6);
+    ASSERT_EQ(receive(), "TACOS");
+    const auto endless = std::string(UnixSocketServer::maxRequestLength + 1, 'x');
+    ASSERT_EQ(write(client, endless.data(), endless.size()), endless.size());
+    ASSERT_EQ(receive(), "error request too long");
+    char c = 0;
+    ASSERT_EQ(read(client, &c, 1), 0);
+    close(client);
+
+    // once stopped, the connections are joined and the socket file is removed
+    server.stop();
+    serving.join();
+    ASSERT_TRUE(served);
+    ASSERT_FALSE(std::filesystem::exists(path));
+}
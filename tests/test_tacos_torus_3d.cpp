@@ -38,7 +38,7 @@ TEST_F(TestConfig, Torus3x3x3) {
 
     auto minCollectiveTime = std::numeric_limits<EventQueue::Time>::max();
     for (int i = 0; i < repeat; ++i) {
-        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize);
+        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize).collectiveTime();
         minCollectiveTime = std::min(minCollectiveTime, collectiveTime);
     }
 
@@ -69,7 +69,7 @@ TEST_F(TestConfig, Torus3x4x5) {
 
     auto minCollectiveTime = std::numeric_limits<EventQueue::Time>::max();
     for (int i = 0; i < repeat; ++i) {
-        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize);
+        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize).collectiveTime();
         minCollectiveTime = std::min(minCollectiveTime, collectiveTime);
     }
 
@@ -100,7 +100,7 @@ TEST_F(TestConfig, Torus4x2x3) {
 
     auto minCollectiveTime = std::numeric_limits<EventQueue::Time>::max();
     for (int i = 0; i < repeat; ++i) {
-        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize);
+        auto collectiveTime = synthesizer.solve(topology, collective, chunkSize).collectiveTime();
         minCollectiveTime = std::min(minCollectiveTime, collectiveTime);
     }
 
@@ -0,0 +1,180 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <numeric>
+#include <tacos/collective/all_gather.h>
+#include <tacos/collective/concurrent_collective.h>
+#include <tacos/collective/reduce_scatter.h>
+#include <tacos/collective/workload.h>
+#include <tacos/synthesizer/concurrent_synthesizer.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/synthesizer/time_expanded_network.h>
+#include <tacos/synthesizer/workload_synthesizer.h>
+#include <tacos/topology/mesh_2d.h>
+#include <test_config.h>
+#include <vector>
+
+using namespace tacos;
+
+TEST_F(TestConfig, WorkloadLayers) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto chunkSize = int64_t(1 << 20);
+    const auto linkTime = TimeExpandedNetwork(topology, chunkSize).linkTransferTime(0, 1);
+
+    // every layer reduce-scatters its gradients after its backward pass,
+    // then all-gathers its updated weights after the optimizer step
+    const auto layersCount = 3;
+    const auto backwardTime = 20.0;
+    const auto optimizerTime = 5.0;
+    auto workload = Workload();
+    auto reduceScatter = -1;
+    for (auto layer = 0; layer < layersCount; layer++) {
+        auto dependencies = std::vector<Workload::StepID>();
+        if (reduceScatter >= 0) {
+            dependencies.push_back(reduceScatter);
+        }
+        reduceScatter = workload.add(std::make_shared<ReduceScatter>(npusCount, 2), chunkSize,
+                                     dependencies, backwardTime);
+        workload.add(std::make_shared<AllGather>(npusCount, 2), chunkSize, {reduceScatter},
+                     optimizerTime);
+    }
+    ASSERT_EQ(workload.stepsCount(), layersCount * 2);
+    ASSERT_EQ(workload.dependencies(3), std::vector<Workload::StepID>{2});
+    ASSERT_DOUBLE_EQ(workload.computeTime(1), optimizerTime);
+
+    for (int i = 0; i < repeat; ++i) {
+        auto workloadSynthesizer = WorkloadSynthesizer();
+        workloadSynthesizer.synthesizer().seed(i);
+        auto result = workloadSynthesizer.solve(topology, workload);
+
+        // every step is issued once its dependencies are complete and computed upon,
+        // and uses a link only after the steps issued before are done with it
+        auto steps = std::vector<Workload::StepID>(workload.stepsCount());
+        std::iota(steps.begin(), steps.end(), 0);
+        std::stable_sort(steps.begin(), steps.end(), [&](const int lhs, const int rhs) {
+            return result.issueTimes[lhs] < result.issueTimes[rhs];
+        });
+        auto linksBusyUntil = std::vector<std::vector<double>>(
+            npusCount, std::vector<double>(npusCount, 0));
+        auto iterationTime = 0.0;
+        for (const auto step : steps) {
+            auto issueTime = 0.0;
+            for (const auto dependency : workload.dependencies(step)) {
+                issueTime = std::max(issueTime, result.completionTimes[dependency]);
+            }
+            issueTime += workload.computeTime(step);
+            ASSERT_DOUBLE_EQ(result.issueTimes[step], issueTime);
+
+            auto& synthesisResult = result.synthesisResults[step];
+            auto stepBusyUntil = linksBusyUntil;
+            for (auto src = 0; src < npusCount; src++) {
+                for (const auto& [dest, link] : synthesisResult.npu(src).egressLinks()) {
+                    for (const auto& [opId, op] : link.ops()) {
+                        const auto startTime = op.time() - linkTime;
+                        ASSERT_GE(startTime + 1e-9, issueTime);
+                        ASSERT_GE(startTime + 1e-9, linksBusyUntil[src][dest]);
+                        stepBusyUntil[src][dest] = std::max(stepBusyUntil[src][dest], op.time());
+                    }
+                }
+            }
+            linksBusyUntil = std::move(stepBusyUntil);
+
+            ASSERT_DOUBLE_EQ(result.completionTimes[step], synthesisResult.collectiveTime());
+            ASSERT_GT(result.completionTimes[step], issueTime);
+            iterationTime = std::max(iterationTime, result.completionTimes[step]);
+        }
+        ASSERT_DOUBLE_EQ(result.iterationTime, iterationTime);
+    }
+}
+
+TEST_F(TestConfig, WorkloadOverlap) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto chunkSize = int64_t(1 << 20);
+
+    // two independent all-gathers issued at once share the links,
+    // unlike two isolated solves that both assume idle links
+    auto workload = Workload();
+    workload.add(std::make_shared<AllGather>(npusCount), chunkSize);
+    workload.add(std::make_shared<AllGather>(npusCount), chunkSize);
+    for (int i = 0; i < repeat; ++i) {
+        auto workloadSynthesizer = WorkloadSynthesizer();
+        workloadSynthesizer.synthesizer().seed(i);
+        const auto result = workloadSynthesizer.solve(topology, workload);
+        ASSERT_DOUBLE_EQ(result.issueTimes[1], 0);
+
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        const auto isolatedResult = synthesizer.solve(topology, AllGather(npusCount), chunkSize);
+        ASSERT_GT(result.completionTimes[1], isolatedResult.collectiveTime());
+        ASSERT_GT(result.iterationTime, isolatedResult.collectiveTime());
+    }
+}
+
+TEST_F(TestConfig, WorkloadIssueOrder) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto chunkSize = int64_t(1 << 20);
+
+    // the second step is issued first, so that it does not wait behind the first one
+    auto workload = Workload();
+    workload.add(std::make_shared<AllGather>(npusCount), chunkSize, {}, 1000.0);
+    workload.add(std::make_shared<AllGather>(npusCount), chunkSize);
+    for (int i = 0; i < repeat; ++i) {
+        auto workloadSynthesizer = WorkloadSynthesizer();
+        workloadSynthesizer.synthesizer().seed(i);
+        const auto result = workloadSynthesizer.solve(topology, workload);
+        ASSERT_DOUBLE_EQ(result.issueTimes[0], 1000.0);
+        ASSERT_DOUBLE_EQ(result.issueTimes[1], 0);
+
+        auto synthesizer = Synthesizer();
+        synthesizer.seed(i);
+        const auto isolatedResult = synthesizer.solve(topology, AllGather(npusCount), chunkSize);
+        ASSERT_DOUBLE_EQ(result.completionTimes[1], isolatedResult.collectiveTime());
+        ASSERT_GT(result.completionTimes[0], 1000.0);
+    }
+}
+
+TEST_F(TestConfig, WorkloadConcurrentCollective) {
+    const auto topology = Mesh2D(4, 4, 50.0, 0.5);
+    const auto chunkSize = int64_t(1 << 20);
+
+    // row-wise all-gathers, then column-wise ones over the same workload
+    auto rows = std::make_shared<ConcurrentCollective>();
+    auto columns = std::make_shared<ConcurrentCollective>();
+    for (auto index = 0; index < 4; index++) {
+        rows->add(AllGather(4), {index * 4, index * 4 + 1, index * 4 + 2, index * 4 + 3});
+        columns->add(AllGather(4), {index, index + 4, index + 8, index + 12});
+    }
+    auto workload = Workload();
+    const auto rowsStep = workload.add(rows, chunkSize);
+    const auto columnsStep = workload.add(columns, chunkSize, {rowsStep}, 10.0);
+
+    // the steps keep their groups, along which their schedules are split
+    ASSERT_EQ(&workload.collective(columnsStep), columns.get());
+    const auto& rowsCollective = workload.collective(rowsStep);
+    ASSERT_EQ(static_cast<const ConcurrentCollective&>(rowsCollective).groupsCount(), 4);
+    for (int i = 0; i < repeat; ++i) {
+        auto workloadSynthesizer = WorkloadSynthesizer();
+        workloadSynthesizer.synthesizer().seed(i);
+        auto result = workloadSynthesizer.solve(topology, workload);
+        ASSERT_DOUBLE_EQ(result.issueTimes[columnsStep], result.completionTimes[rowsStep] + 10.0);
+        for (const auto step : {rowsStep, columnsStep}) {
+            const auto& collective =
+                static_cast<const ConcurrentCollective&>(workload.collective(step));
+            const auto split = ConcurrentSynthesizer::split(topology, collective,
+                                                            result.synthesisResults[step]);
+            ASSERT_DOUBLE_EQ(split.makespan, result.completionTimes[step]);
+        }
+    }
+}
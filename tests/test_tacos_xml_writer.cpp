@@ -0,0 +1,197 @@
+/******************************************************************************
+This source code is licensed under the MIT license found in the
+LICENSE file in the root directory of this source tree.
+
+Copyright (c) 2022-2025 Intel Corporation
+Copyright (c) 2022-2025 Georgia Institute of Technology
+*******************************************************************************/
+
+#include <cstdint>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <pugixml.hpp>
+#include <tacos/collective/all_gather.h>
+#include <tacos/synthesizer/synthesizer.h>
+#include <tacos/topology/hetero_mesh_2d.h>
+#include <tacos/topology/mesh_2d.h>
+#include <tacos/writer/xml_writer.h>
+#include <test_config.h>
+#include <vector>
+
+using namespace tacos;
+
+namespace {
+
+/// @brief Check every send dependency refers to a recv step overlapping its buffer range.
+void checkDependencies(const pugi::xml_node& algo) {
+    for (const auto gpu : algo.children("gpu")) {
+        auto tbs = std::vector<pugi::xml_node>();
+        for (const auto tb : gpu.children("tb")) {
+            ASSERT_EQ(tb.attribute("id").as_int(), static_cast<int>(tbs.size()));
+            tbs.push_back(tb);
+        }
+
+        for (const auto tb : tbs) {
+            for (const auto step : tb.children("step")) {
+                const auto depid = step.attribute("depid").as_int();
+                if (depid < 0) {
+                    continue;
+                }
+                ASSERT_LT(depid, static_cast<int>(tbs.size()));
+
+                auto steps = std::vector<pugi::xml_node>();
+                for (const auto depStep : tbs[depid].children("step")) {
+                    steps.push_back(depStep);
+                }
+                const auto deps = step.attribute("deps").as_int();
+                ASSERT_LT(deps, static_cast<int>(steps.size()));
+                ASSERT_STREQ(steps[deps].attribute("type").value(), "r");
+                const auto depBegin = steps[deps].attribute("dstoff").as_int();
+                const auto depEnd = depBegin + steps[deps].attribute("cnt").as_int();
+                const auto begin = step.attribute("srcoff").as_int();
+                const auto end = begin + step.attribute("cnt").as_int();
+                ASSERT_LT(depBegin, end);
+                ASSERT_LT(begin, depEnd);
+                ASSERT_EQ(steps[deps].attribute("hasdep").as_int(), 1);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+TEST_F(TestConfig, XmlWriterChannels) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 2);
+    const auto chunksCount = collective.chunksCount();
+    const auto chunkSize = int64_t(1 << 20);
+
+    auto synthesizer = Synthesizer();
+    auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+
+    const auto path = (std::filesystem::temp_directory_path() / "tacos_channels.xml").string();
+    const auto channelsCount = 3;
+
+    for (const auto policy :
+         {XmlWriter::ChannelPolicy::LinkRoundRobin, XmlWriter::ChannelPolicy::ChunkSplit}) {
+        auto writer = XmlWriter(path, topology, collective, synthesisResult);
+        writer.channels(channelsCount, policy);
+        writer.write();
+
+        auto xml = pugi::xml_document();
+        ASSERT_TRUE(xml.load_file(path.c_str()));
+        const auto algo = xml.document_element();
+        ASSERT_EQ(algo.attribute("nchannels").as_int(), channelsCount);
+
+        const auto split = (policy == XmlWriter::ChannelPolicy::ChunkSplit);
+        const auto chunksPerLoop = split ? chunksCount * channelsCount : chunksCount;
+        ASSERT_EQ(algo.attribute("nchunksperloop").as_int(), chunksPerLoop);
+
+        // every NPU receives each (sub-)chunk it does not own exactly once
+        for (const auto gpu : algo.children("gpu")) {
+            auto recvSteps = 0;
+            for (const auto tb : gpu.children("tb")) {
+                ASSERT_LT(tb.attribute("chan").as_int(), channelsCount);
+                for (const auto step : tb.children("step")) {
+                    if (std::string(step.attribute("type").value()) == "r") {
+                        recvSteps++;
+                    }
+                }
+            }
+            ASSERT_EQ(recvSteps, chunksPerLoop - (chunksPerLoop / npusCount));
+        }
+
+        checkDependencies(algo);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_F(TestConfig, XmlWriterFuseThreadblocks) {
+    const auto topology = HeteroMesh2D(3, 3, 50.0, 0.5, 25.0, 1.0);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 2);
+    const auto chunkSize = int64_t(1 << 20);
+
+    auto synthesizer = Synthesizer();
+    auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+
+    const auto path = (std::filesystem::temp_directory_path() / "tacos_fused.xml").string();
+    auto writer = XmlWriter(path, topology, collective, synthesisResult);
+    writer.fuseThreadblocks();
+    writer.write();
+
+    auto xml = pugi::xml_document();
+    ASSERT_TRUE(xml.load_file(path.c_str()));
+    const auto algo = xml.document_element();
+
+    // every peer is served by a single bidirectional threadblock
+    for (const auto gpu : algo.children("gpu")) {
+        const auto npu = gpu.attribute("id").as_int();
+        auto peersCount = 0;
+        for (auto peer = 0; peer < npusCount; peer++) {
+            if (peer != npu && topology.connected(npu, peer)) {
+                peersCount++;
+            }
+        }
+
+        auto tbsCount = 0;
+        for (const auto tb : gpu.children("tb")) {
+            ASSERT_EQ(tb.attribute("send").as_int(), tb.attribute("recv").as_int());
+            tbsCount++;
+        }
+        ASSERT_EQ(tbsCount, peersCount);
+    }
+
+    checkDependencies(algo);
+    std::filesystem::remove(path);
+}
+
+TEST_F(TestConfig, XmlWriterCoalesceSteps) {
+    const auto topology = Mesh2D(3, 3, 50.0, 0.5);
+    const auto npusCount = topology.npusCount();
+    const auto collective = AllGather(npusCount, 4);
+    const auto chunksCount = collective.chunksCount();
+    const auto chunkSize = int64_t(1 << 20);
+
+    const auto path = (std::filesystem::temp_directory_path() / "tacos_coalesced.xml").string();
+    auto coalescedSteps = 0;
+
+    for (auto i = 0; i < repeat; i++) {
+        auto synthesizer = Synthesizer();
+        auto synthesisResult = synthesizer.solve(topology, collective, chunkSize);
+
+        auto writer = XmlWriter(path, topology, collective, synthesisResult);
+        writer.coalesceSteps();
+        writer.fuseThreadblocks();
+        writer.write();
+
+        auto xml = pugi::xml_document();
+        ASSERT_TRUE(xml.load_file(path.c_str()));
+        const auto algo = xml.document_element();
+
+        // every NPU still receives each chunk it does not own exactly once
+        for (const auto gpu : algo.children("gpu")) {
+            auto recvChunks = 0;
+            for (const auto tb : gpu.children("tb")) {
+                for (const auto step : tb.children("step")) {
+                    const auto count = step.attribute("cnt").as_int();
+                    ASSERT_GE(count, 1);
+                    if (count > 1) {
+                        coalescedSteps++;
+                    }
+                    if (std::string(step.attribute("type").value()) == "r") {
+                        recvChunks += count;
+                    }
+                }
+            }
+            ASSERT_EQ(recvChunks, chunksCount - (chunksCount / npusCount));
+        }
+
+        checkDependencies(algo);
+    }
+
+    ASSERT_GT(coalescedSteps, 0);
+    std::filesystem::remove(path);
+}